@@ -0,0 +1,601 @@
+//******************************************************************************************************
+//  AesCipher.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "AesCipher.h"
+#include <cstring>
+
+#ifndef GSF_USE_PORTABLE_AES
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#else
+#include <random>
+#endif
+
+using namespace std;
+using namespace GSF;
+
+namespace
+{
+#ifndef GSF_USE_PORTABLE_AES
+    const EVP_CIPHER* GetCbcCipher(uint32_t keyLength)
+    {
+        switch (keyLength)
+        {
+            case 16:
+                return EVP_aes_128_cbc();
+            case 24:
+                return EVP_aes_192_cbc();
+            default:
+                return EVP_aes_256_cbc();
+        }
+    }
+
+    // Initializes the context with the key schedule, the context is allocated on first use
+    void InitializeContext(EVP_CIPHER_CTX*& context, const uint8_t* key, uint32_t keyLength, int32_t encrypt)
+    {
+        if (context == nullptr)
+        {
+            context = EVP_CIPHER_CTX_new();
+
+            if (context == nullptr)
+                throw runtime_error("Failed to allocate OpenSSL cipher context");
+        }
+
+        // Padding is applied by AesCipher, so OpenSSL only sees whole blocks
+        if (EVP_CipherInit_ex(context, GetCbcCipher(keyLength), nullptr, key, nullptr, encrypt) != 1 || EVP_CIPHER_CTX_set_padding(context, 0) != 1)
+            throw runtime_error("OpenSSL failed to initialize AES key");
+    }
+
+    void TransformBlocks(EVP_CIPHER_CTX* context, uint8_t* buffer, uint32_t length, const uint8_t* iv)
+    {
+        int32_t transformedLength = 0;
+
+        // Only the IV changes, the cipher, key and direction set by InitializeContext are kept
+        if (EVP_CipherInit_ex(context, nullptr, nullptr, nullptr, iv, -1) != 1 ||
+            EVP_CipherUpdate(context, buffer, &transformedLength, buffer, static_cast<int32_t>(length)) != 1)
+            throw runtime_error("OpenSSL failed to transform AES blocks");
+    }
+#else
+    // Bit-sliced form of a block, bit j of plane i holds bit i of byte j. Each operation on
+    // the planes processes all sixteen bytes at once without any data dependent access.
+    typedef uint32_t Planes[8];
+
+    // Transposes eight bytes as an 8x8 bit matrix, where bit i of byte j moves to bit j of byte i
+    uint64_t TransposeBits(uint64_t value)
+    {
+        uint64_t swap = (value ^ value >> 7) & 0x00AA00AA00AA00AAULL;
+        value ^= swap ^ swap << 7;
+
+        swap = (value ^ value >> 14) & 0x0000CCCC0000CCCCULL;
+        value ^= swap ^ swap << 14;
+
+        swap = (value ^ value >> 28) & 0x00000000F0F0F0F0ULL;
+        value ^= swap ^ swap << 28;
+
+        return value;
+    }
+
+    uint64_t ReadHalf(const uint8_t* bytes)
+    {
+        uint64_t value = 0;
+
+        for (uint32_t j = 0; j < 8; j++)
+            value |= static_cast<uint64_t>(bytes[j]) << 8 * j;
+
+        return value;
+    }
+
+    void ToPlanes(const uint8_t* bytes, Planes planes)
+    {
+        const uint64_t low = TransposeBits(ReadHalf(bytes));
+        const uint64_t high = TransposeBits(ReadHalf(bytes + 8));
+
+        for (uint32_t i = 0; i < 8; i++)
+            planes[i] = static_cast<uint32_t>(low >> 8 * i & 0xFF) | static_cast<uint32_t>(high >> 8 * i & 0xFF) << 8;
+    }
+
+    void FromPlanes(const Planes planes, uint8_t* bytes)
+    {
+        uint64_t low = 0, high = 0;
+
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            low |= static_cast<uint64_t>(planes[i] & 0xFF) << 8 * i;
+            high |= static_cast<uint64_t>(planes[i] >> 8 & 0xFF) << 8 * i;
+        }
+
+        low = TransposeBits(low);
+        high = TransposeBits(high);
+
+        for (uint32_t j = 0; j < 8; j++)
+        {
+            bytes[j] = static_cast<uint8_t>(low >> 8 * j);
+            bytes[j + 8] = static_cast<uint8_t>(high >> 8 * j);
+        }
+    }
+
+    // Mask of all ones when the given bit of the constant is set
+    uint32_t ConstantMask(uint8_t constant, uint32_t bit)
+    {
+        return 0U - (static_cast<uint32_t>(constant) >> bit & 1U);
+    }
+
+    // Multiplies the planes by a matrix over GF(2), bit j of row i selects input plane j for output plane i
+    void Transform(const uint8_t (&matrix)[8], const Planes input, Planes output)
+    {
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            uint32_t plane = 0;
+
+            for (uint32_t j = 0; j < 8; j++)
+                plane ^= input[j] & ConstantMask(matrix[i], j);
+
+            output[i] = plane;
+        }
+    }
+
+    // Inversion in GF(2^8) is far cheaper in the isomorphic tower field GF((2^4)^2), built from
+    // GF(2^4) modulo y^4 + y + 1 and z^2 + z + 8. Upper planes hold the z coefficient. Changes of
+    // basis are merged with the affine transformations of the S-box and its inverse.
+    const uint8_t ToTower[8] = { 0xA1, 0x04, 0xFC, 0x18, 0x70, 0xD2, 0xAC, 0xA0 };
+    const uint8_t FromTower[8] = { 0x81, 0xB0, 0x02, 0xC2, 0xCA, 0x54, 0x8E, 0xD4 };
+    const uint8_t FromTowerAffine[8] = { 0x45, 0x3F, 0x69, 0x25, 0x3B, 0xEE, 0xD0, 0x06 };
+    const uint8_t InverseAffineToTower[8] = { 0x62, 0x92, 0x12, 0x6F, 0xF7, 0x78, 0x71, 0xC6 };
+    const uint8_t AffineConstant = 0x63;
+    const uint8_t InverseAffineToTowerConstant = 0x47;
+    const uint32_t TowerConstant[4] = { 0U, 0U, 0U, ~0U };
+
+    // Multiplies four plane elements of GF(2^4), reducing with y^4 = y + 1
+    void Multiply(const uint32_t* a, const uint32_t* b, uint32_t* result)
+    {
+        uint32_t product[7] = {};
+
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            for (uint32_t j = 0; j < 4; j++)
+                product[i + j] ^= a[i] & b[j];
+        }
+
+        for (uint32_t i = 6; i >= 4; i--)
+        {
+            product[i - 3] ^= product[i];
+            product[i - 4] ^= product[i];
+        }
+
+        memcpy(result, product, 4 * sizeof(uint32_t));
+    }
+
+    // Squaring is linear, each bit simply moves to twice its degree before reduction
+    void Square(const uint32_t* a, uint32_t* result)
+    {
+        const uint32_t product[4] = { a[0] ^ a[2], a[2], a[1] ^ a[3], a[3] };
+        memcpy(result, product, sizeof(product));
+    }
+
+    // Computes the inverse in GF(2^4) as a^14, which also maps zero to zero
+    void Invert(const uint32_t* a, uint32_t* result)
+    {
+        uint32_t a2[4], a4[4], a8[4], a6[4];
+
+        Square(a, a2);
+        Square(a2, a4);
+        Square(a4, a8);
+        Multiply(a2, a4, a6);
+        Multiply(a6, a8, result);
+    }
+
+    // Computes the inverse in the tower field, zero maps to zero as the S-box requires
+    void InvertTower(const Planes x, Planes result)
+    {
+        const uint32_t* high = x + 4;
+        const uint32_t* low = x;
+        uint32_t highSquared[4], norm[4], product[4], lowSquared[4], sum[4], inverse[4];
+
+        // Norm is high^2 * 8 + high * low + low^2, an element of GF(2^4)
+        Square(high, highSquared);
+        Multiply(highSquared, TowerConstant, norm);
+        Multiply(high, low, product);
+        Square(low, lowSquared);
+
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            norm[i] ^= product[i] ^ lowSquared[i];
+            sum[i] = high[i] ^ low[i];
+        }
+
+        Invert(norm, inverse);
+        Multiply(high, inverse, result + 4);
+        Multiply(sum, inverse, result);
+    }
+
+    void SubstituteBytes(uint8_t* bytes)
+    {
+        Planes planes, tower;
+
+        ToPlanes(bytes, planes);
+        Transform(ToTower, planes, tower);
+        InvertTower(tower, planes);
+        Transform(FromTowerAffine, planes, tower);
+
+        for (uint32_t i = 0; i < 8; i++)
+            tower[i] ^= ConstantMask(AffineConstant, i);
+
+        FromPlanes(tower, bytes);
+    }
+
+    void InverseSubstituteBytes(uint8_t* bytes)
+    {
+        Planes planes, tower;
+
+        ToPlanes(bytes, planes);
+        Transform(InverseAffineToTower, planes, tower);
+
+        for (uint32_t i = 0; i < 8; i++)
+            tower[i] ^= ConstantMask(InverseAffineToTowerConstant, i);
+
+        InvertTower(tower, planes);
+        Transform(FromTower, planes, tower);
+        FromPlanes(tower, bytes);
+    }
+
+    // Multiplies by x in GF(2^8), masking the reduction instead of branching on the high bit
+    uint8_t MultiplyByX(uint8_t value)
+    {
+        return static_cast<uint8_t>(value << 1 ^ (0x1B & (0U - (value >> 7))));
+    }
+
+    // State is column-major, byte r + 4c is at row r and column c
+    void ShiftRows(uint8_t* state)
+    {
+        uint8_t shifted[AesCipher::BlockSize];
+
+        for (uint32_t column = 0; column < 4; column++)
+        {
+            for (uint32_t row = 0; row < 4; row++)
+                shifted[row + 4 * column] = state[row + 4 * ((column + row) % 4)];
+        }
+
+        memcpy(state, shifted, AesCipher::BlockSize);
+    }
+
+    void InverseShiftRows(uint8_t* state)
+    {
+        uint8_t shifted[AesCipher::BlockSize];
+
+        for (uint32_t column = 0; column < 4; column++)
+        {
+            for (uint32_t row = 0; row < 4; row++)
+                shifted[row + 4 * ((column + row) % 4)] = state[row + 4 * column];
+        }
+
+        memcpy(state, shifted, AesCipher::BlockSize);
+    }
+
+    void MixColumns(uint8_t* state)
+    {
+        for (uint8_t* column = state; column < state + AesCipher::BlockSize; column += 4)
+        {
+            const uint8_t total = column[0] ^ column[1] ^ column[2] ^ column[3];
+            const uint8_t first = column[0];
+
+            column[0] ^= total ^ MultiplyByX(column[0] ^ column[1]);
+            column[1] ^= total ^ MultiplyByX(column[1] ^ column[2]);
+            column[2] ^= total ^ MultiplyByX(column[2] ^ column[3]);
+            column[3] ^= total ^ MultiplyByX(column[3] ^ first);
+        }
+    }
+
+    void InverseMixColumns(uint8_t* state)
+    {
+        // Inverse matrix factors into a premultiplication followed by the forward matrix
+        for (uint8_t* column = state; column < state + AesCipher::BlockSize; column += 4)
+        {
+            const uint8_t even = MultiplyByX(MultiplyByX(column[0] ^ column[2]));
+            const uint8_t odd = MultiplyByX(MultiplyByX(column[1] ^ column[3]));
+
+            column[0] ^= even;
+            column[1] ^= odd;
+            column[2] ^= even;
+            column[3] ^= odd;
+        }
+
+        MixColumns(state);
+    }
+
+    void AddRoundKey(uint8_t* state, const uint8_t* roundKey)
+    {
+        for (uint32_t i = 0; i < AesCipher::BlockSize; i++)
+            state[i] ^= roundKey[i];
+    }
+#endif
+}
+
+AesCipher::AesCipher() :
+    m_roundKeys{},
+    m_keyLength(0),
+    m_rounds(0),
+    m_encryptContext(nullptr),
+    m_decryptContext(nullptr)
+{
+}
+
+AesCipher::AesCipher(const uint8_t* key, uint32_t keyLength) :
+    AesCipher()
+{
+    SetKey(key, keyLength);
+}
+
+AesCipher::~AesCipher()
+{
+#ifndef GSF_USE_PORTABLE_AES
+    EVP_CIPHER_CTX_free(m_encryptContext);
+    EVP_CIPHER_CTX_free(m_decryptContext);
+#endif
+
+    memset(m_roundKeys, 0, sizeof(m_roundKeys));
+}
+
+void AesCipher::SetKey(const uint8_t* key, uint32_t keyLength)
+{
+    if (keyLength != 16 && keyLength != 24 && keyLength != 32)
+        throw invalid_argument("AES key length must be 16, 24 or 32 bytes");
+
+    m_keyLength = keyLength;
+    m_rounds = keyLength / 4 + 6;
+
+#ifndef GSF_USE_PORTABLE_AES
+    InitializeContext(m_encryptContext, key, keyLength, 1);
+    InitializeContext(m_decryptContext, key, keyLength, 0);
+#else
+    // Expand the key schedule into round keys, stored as bytes in the order they are applied
+    const uint32_t keyWords = keyLength / 4;
+    const uint32_t totalWords = 4 * (m_rounds + 1);
+    uint8_t roundConstant = 1;
+
+    memcpy(m_roundKeys, key, keyLength);
+
+    for (uint32_t i = keyWords; i < totalWords; i++)
+    {
+        // Substitution works on a full block, only the first word is used
+        uint8_t word[BlockSize] = {};
+        memcpy(word, m_roundKeys + 4 * (i - 1), 4);
+
+        if (i % keyWords == 0)
+        {
+            const uint8_t first = word[0];
+
+            word[0] = word[1];
+            word[1] = word[2];
+            word[2] = word[3];
+            word[3] = first;
+
+            SubstituteBytes(word);
+            word[0] ^= roundConstant;
+            roundConstant = MultiplyByX(roundConstant);
+        }
+        else if (keyWords > 6 && i % keyWords == 4)
+        {
+            SubstituteBytes(word);
+        }
+
+        for (uint32_t j = 0; j < 4; j++)
+            m_roundKeys[4 * i + j] = word[j] ^ m_roundKeys[4 * (i - keyWords) + j];
+    }
+#endif
+}
+
+bool AesCipher::KeyDefined() const
+{
+    return m_rounds > 0;
+}
+
+#ifndef GSF_USE_PORTABLE_AES
+
+void AesCipher::EncryptBlocks(uint8_t* buffer, uint32_t length, const uint8_t* iv) const
+{
+    TransformBlocks(m_encryptContext, buffer, length, iv);
+}
+
+void AesCipher::DecryptBlocks(uint8_t* buffer, uint32_t length, const uint8_t* iv) const
+{
+    TransformBlocks(m_decryptContext, buffer, length, iv);
+}
+
+#else
+
+void AesCipher::EncryptBlocks(uint8_t* buffer, uint32_t length, const uint8_t* iv) const
+{
+    const uint8_t* previous = iv;
+
+    for (uint8_t* block = buffer; block < buffer + length; block += BlockSize)
+    {
+        for (uint32_t i = 0; i < BlockSize; i++)
+            block[i] ^= previous[i];
+
+        AddRoundKey(block, m_roundKeys);
+
+        for (uint32_t round = 1; round < m_rounds; round++)
+        {
+            SubstituteBytes(block);
+            ShiftRows(block);
+            MixColumns(block);
+            AddRoundKey(block, m_roundKeys + BlockSize * round);
+        }
+
+        // Final round has no mix columns step
+        SubstituteBytes(block);
+        ShiftRows(block);
+        AddRoundKey(block, m_roundKeys + BlockSize * m_rounds);
+
+        previous = block;
+    }
+}
+
+void AesCipher::DecryptBlocks(uint8_t* buffer, uint32_t length, const uint8_t* iv) const
+{
+    uint8_t previous[BlockSize];
+    uint8_t cipherText[BlockSize];
+
+    memcpy(previous, iv, BlockSize);
+
+    for (uint8_t* block = buffer; block < buffer + length; block += BlockSize)
+    {
+        // Keep the cipher text of this block, it chains into the next block
+        memcpy(cipherText, block, BlockSize);
+
+        AddRoundKey(block, m_roundKeys + BlockSize * m_rounds);
+
+        for (uint32_t round = m_rounds - 1; round > 0; round--)
+        {
+            InverseShiftRows(block);
+            InverseSubstituteBytes(block);
+            AddRoundKey(block, m_roundKeys + BlockSize * round);
+            InverseMixColumns(block);
+        }
+
+        // Final round has no inverse mix columns step
+        InverseShiftRows(block);
+        InverseSubstituteBytes(block);
+        AddRoundKey(block, m_roundKeys);
+
+        for (uint32_t i = 0; i < BlockSize; i++)
+            block[i] ^= previous[i];
+
+        memcpy(previous, cipherText, BlockSize);
+    }
+}
+
+#endif
+
+uint32_t AesCipher::GetEncryptedLength(uint32_t length)
+{
+    // PKCS#7 always adds padding, a full block when the length is already block aligned
+    return (length / BlockSize + 1) * BlockSize;
+}
+
+uint32_t AesCipher::Encrypt(uint8_t* buffer, uint32_t length, const uint8_t* iv) const
+{
+    if (!KeyDefined())
+        throw runtime_error("Cannot encrypt, no AES key has been defined");
+
+    const uint32_t encryptedLength = GetEncryptedLength(length);
+    const uint8_t padding = static_cast<uint8_t>(encryptedLength - length);
+
+    for (uint32_t i = length; i < encryptedLength; i++)
+        buffer[i] = padding;
+
+    EncryptBlocks(buffer, encryptedLength, iv);
+
+    return encryptedLength;
+}
+
+uint32_t AesCipher::Decrypt(uint8_t* buffer, uint32_t length, const uint8_t* iv) const
+{
+    if (!KeyDefined())
+        throw runtime_error("Cannot decrypt, no AES key has been defined");
+
+    if (length == 0 || length % BlockSize != 0)
+        throw runtime_error("Encrypted data length is not a multiple of the AES block size");
+
+    DecryptBlocks(buffer, length, iv);
+
+    const uint8_t padding = buffer[length - 1];
+
+    if (padding == 0 || padding > BlockSize)
+        throw runtime_error("Decrypted data has invalid AES padding");
+
+    for (uint32_t i = length - padding; i < length - 1; i++)
+    {
+        if (buffer[i] != padding)
+            throw runtime_error("Decrypted data has invalid AES padding");
+    }
+
+    return length - padding;
+}
+
+void AesCipher::GenerateRandomBytes(uint8_t* buffer, uint32_t length)
+{
+#ifndef GSF_USE_PORTABLE_AES
+    if (RAND_bytes(buffer, static_cast<int32_t>(length)) != 1)
+        throw runtime_error("OpenSSL failed to generate random bytes");
+#else
+    static Mutex generatorLock;
+    static AesCipher generator;
+    static uint8_t counter[BlockSize];
+
+    ScopeLock lock(generatorLock);
+
+    // Output is the encrypted counter, the zero IV reduces CBC over a single block to the raw cipher
+    const uint8_t zero[BlockSize] = {};
+    uint8_t block[BlockSize];
+
+    const auto nextBlock = [&]
+    {
+        // Increment the big-endian counter
+        for (int32_t i = BlockSize - 1; i >= 0; i--)
+        {
+            if (++counter[i] != 0)
+                break;
+        }
+
+        memcpy(block, counter, BlockSize);
+        generator.EncryptBlocks(block, BlockSize, zero);
+    };
+
+    if (!generator.KeyDefined())
+    {
+        random_device random;
+        uint8_t seed[MaxKeySize + BlockSize];
+
+        for (uint32_t i = 0; i < sizeof(seed); i += sizeof(uint32_t))
+        {
+            const uint32_t value = random();
+            memcpy(seed + i, &value, sizeof(uint32_t));
+        }
+
+        generator.SetKey(seed, MaxKeySize);
+        memcpy(counter, seed + MaxKeySize, BlockSize);
+        memset(seed, 0, sizeof(seed));
+    }
+
+    for (uint32_t offset = 0; offset < length; offset += BlockSize)
+    {
+        const uint32_t remaining = length - offset;
+
+        nextBlock();
+        memcpy(buffer + offset, block, remaining < BlockSize ? remaining : BlockSize);
+    }
+
+    // Replace the key after each draw so that the state cannot reproduce earlier output
+    uint8_t key[MaxKeySize];
+
+    nextBlock();
+    memcpy(key, block, BlockSize);
+    nextBlock();
+    memcpy(key + BlockSize, block, BlockSize);
+
+    generator.SetKey(key, MaxKeySize);
+    memset(key, 0, sizeof(key));
+    memset(block, 0, sizeof(block));
+#endif
+}
@@ -0,0 +1,109 @@
+//******************************************************************************************************
+//  AesCipher.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __AES_CIPHER_H
+#define __AES_CIPHER_H
+
+#include "CommonTypes.h"
+
+// OpenSSL cipher context, declared here so the layout of the cipher does not depend on the build option
+struct evp_cipher_ctx_st;
+
+namespace GSF
+{
+    // AES block cipher, as defined by FIPS-197, operating in CBC mode with PKCS#7 padding.
+    // This matches the symmetric algorithm defaults used by other GEP implementations.
+    //
+    // Blocks are transformed by OpenSSL. Builds with GSF_USE_PORTABLE_AES, see the USE_PORTABLE_AES
+    // build option, use a portable core instead which computes the S-box arithmetically on bit-sliced
+    // state rather than using lookup tables, so that neither memory access nor branches depend on key
+    // or data. The portable core is much slower than OpenSSL and has not had an independent side
+    // channel review, it is only meant for platforms where OpenSSL is not available.
+    //
+    // The key schedule is expanded once when the key is set, so a cipher can be reused for
+    // any number of messages. Encryption and decryption are performed in place to avoid
+    // allocating a separate output buffer for each message. Since the OpenSSL contexts are
+    // reused, a cipher must not be used by more than one thread at a time.
+    class AesCipher // NOLINT
+    {
+    public:
+        // Size, in bytes, of an AES block. This is also the size of the initialization vector.
+        static const uint32_t BlockSize = 16;
+
+        // Size, in bytes, of the largest key, i.e., AES-256.
+        static const uint32_t MaxKeySize = 32;
+
+    private:
+        static const uint32_t MaxRounds = 14;
+
+        uint8_t m_roundKeys[BlockSize * (MaxRounds + 1)];
+        uint32_t m_keyLength;
+        uint32_t m_rounds;
+
+        // OpenSSL contexts holding the key schedule, only the IV is set per message
+        evp_cipher_ctx_st* m_encryptContext;
+        evp_cipher_ctx_st* m_decryptContext;
+
+        // Transforms whole blocks in place with CBC chaining, padding is handled by the caller
+        void EncryptBlocks(uint8_t* buffer, uint32_t length, const uint8_t* iv) const;
+        void DecryptBlocks(uint8_t* buffer, uint32_t length, const uint8_t* iv) const;
+
+    public:
+        // Creates a new cipher with no key defined.
+        AesCipher();
+
+        // Creates a new cipher with the given 16, 24 or 32 byte key.
+        AesCipher(const uint8_t* key, uint32_t keyLength);
+
+        // Releases the cipher contexts.
+        ~AesCipher();
+
+        AesCipher(const AesCipher&) = delete;
+        AesCipher& operator=(const AesCipher&) = delete;
+
+        // Expands the given 16, 24 or 32 byte key, i.e., AES-128, AES-192 or AES-256.
+        void SetKey(const uint8_t* key, uint32_t keyLength);
+
+        // Determines whether a key has been defined for the cipher.
+        bool KeyDefined() const;
+
+        // Gets the length of the encrypted output for a message of the given length,
+        // i.e., the message length rounded up to the next full block of padding.
+        static uint32_t GetEncryptedLength(uint32_t length);
+
+        // Pads and encrypts the message in place, returning the encrypted length. The buffer
+        // must have room for GetEncryptedLength(length) bytes. The IV must be BlockSize bytes.
+        uint32_t Encrypt(uint8_t* buffer, uint32_t length, const uint8_t* iv) const;
+
+        // Decrypts the message in place and removes the padding, returning the decrypted length.
+        // Throws when the length is not a multiple of the block size or the padding is invalid.
+        uint32_t Decrypt(uint8_t* buffer, uint32_t length, const uint8_t* iv) const;
+
+        // Fills the buffer with cryptographically secure random bytes for keys and initialization
+        // vectors. Bytes come from OpenSSL, or in portable builds from an AES-256 counter mode
+        // generator that is seeded once from std::random_device and rekeyed after every draw.
+        static void GenerateRandomBytes(uint8_t* buffer, uint32_t length);
+    };
+}
+
+#endif
@@ -0,0 +1,126 @@
+//******************************************************************************************************
+//  BufferPool.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/17/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __BUFFER_POOL_H
+#define __BUFFER_POOL_H
+
+#include "CommonTypes.h"
+
+namespace GSF
+{
+    typedef SharedPtr<std::vector<uint8_t>> BufferPtr;
+
+    // Simple pool of reusable byte buffers.
+    //
+    // Buffers are handed out with Acquire and given back with Release once the
+    // consumer is finished with them. A buffer must only be released by its sole
+    // owner, i.e., once nothing else refers to it, since the pool hands it out
+    // again to the next caller of Acquire. Retained buffers keep their capacity so
+    // that steady-state use of the pool does not touch the heap. The pool only
+    // holds on to a limited number of buffers, and buffers that have grown past
+    // the maximum retained capacity are freed rather than returned to the pool.
+    class BufferPool // NOLINT
+    {
+    private:
+        Mutex m_mutex;
+        std::vector<BufferPtr> m_buffers;
+        uint32_t m_maxPoolSize;
+        uint32_t m_maxBufferCapacity;
+
+        bool CanRetain(const BufferPtr& buffer) const
+        {
+            return buffer != nullptr && buffer->capacity() <= m_maxBufferCapacity;
+        }
+
+    public:
+        // Creates a new instance.
+        BufferPool(uint32_t maxPoolSize = 64, uint32_t maxBufferCapacity = 65536) :
+            m_maxPoolSize(maxPoolSize),
+            m_maxBufferCapacity(maxBufferCapacity)
+        {
+        }
+
+        // Gets a buffer from the pool, or creates a new
+        // one if the pool is empty, sized to the given length.
+        BufferPtr Acquire(uint32_t length)
+        {
+            BufferPtr buffer;
+
+            {
+                ScopeLock lock(m_mutex);
+
+                if (!m_buffers.empty())
+                {
+                    buffer = m_buffers.back();
+                    m_buffers.pop_back();
+                }
+            }
+
+            if (buffer == nullptr)
+                buffer = NewSharedPtr<std::vector<uint8_t>>();
+
+            buffer->resize(length);
+
+            return buffer;
+        }
+
+        // Returns a buffer to the pool.
+        void Release(BufferPtr& buffer)
+        {
+            if (CanRetain(buffer))
+            {
+                ScopeLock lock(m_mutex);
+
+                if (m_buffers.size() < m_maxPoolSize)
+                    m_buffers.push_back(buffer);
+            }
+
+            buffer.reset();
+        }
+
+        // Returns a batch of buffers to the pool using a single lock.
+        void Release(std::vector<BufferPtr>& buffers)
+        {
+            {
+                ScopeLock lock(m_mutex);
+
+                for (BufferPtr& buffer : buffers)
+                {
+                    if (m_buffers.size() < m_maxPoolSize && CanRetain(buffer))
+                        m_buffers.push_back(buffer);
+                }
+            }
+
+            buffers.clear();
+        }
+
+        // Frees all buffers held by the pool.
+        void Clear()
+        {
+            ScopeLock lock(m_mutex);
+            m_buffers.clear();
+        }
+    };
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <boost/any.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <boost/utility/string_view.hpp>
 #include <boost/exception/exception.hpp>
 #include <boost/multiprecision/cpp_dec_float.hpp>
 #include <boost/thread.hpp>
@@ -183,10 +184,12 @@ namespace GSF
     typedef boost::asio::ip::udp::socket UdpSocket;
     typedef boost::asio::ip::tcp::acceptor TcpAcceptor;
     typedef boost::asio::ip::tcp::endpoint TcpEndPoint;
+    typedef boost::asio::ip::udp::endpoint UdpEndPoint;
     typedef boost::asio::ip::tcp::resolver DnsResolver;
     typedef boost::iostreams::filtering_streambuf<boost::iostreams::input> StreamBuffer;
     typedef boost::iostreams::gzip_decompressor GZipDecompressor;
     typedef boost::iostreams::gzip_compressor GZipCompressor;
+    typedef boost::string_view StringView;
 
     // Empty types
     struct Empty
@@ -117,6 +117,26 @@ namespace GSF
 
             return length;
         }
+
+        // Writes value in big endian byte order at the given location, which must have room for the value.
+        template<class T>
+        static uint32_t WriteBigEndianBytes(uint8_t* buffer, T value)
+        {
+            value = Default.ConvertBigEndian(value);
+            memcpy(buffer, &value, sizeof(T));
+
+            return sizeof(T);
+        }
+
+        // Writes value in little endian byte order at the given location, which must have room for the value.
+        template<class T>
+        static uint32_t WriteLittleEndianBytes(uint8_t* buffer, T value)
+        {
+            value = Default.ConvertLittleEndian(value);
+            memcpy(buffer, &value, sizeof(T));
+
+            return sizeof(T);
+        }
     };
 }
 
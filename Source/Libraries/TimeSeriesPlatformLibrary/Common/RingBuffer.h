@@ -0,0 +1,501 @@
+//******************************************************************************************************
+//  RingBuffer.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __RING_BUFFER_H
+#define __RING_BUFFER_H
+
+#include "CommonTypes.h"
+#include <atomic>
+
+namespace GSF
+{
+    // Defines the action taken by a bounded queue when an item
+    // is enqueued while the queue is already at capacity.
+    enum class QueueOverflowPolicy
+    {
+        // Producer waits until space is available. Items enqueued by the consumer
+        // thread itself are dropped instead, since it cannot make room while waiting.
+        Block,
+        // Oldest item in the queue is discarded to make room.
+        DropOldest,
+        // Item being enqueued is discarded.
+        DropNewest
+    };
+
+    // Bounded, lock-free queue backed by a fixed-size ring of slots.
+    //
+    // The RingBuffer is intended as an alternative to the ThreadSafeQueue for the
+    // same multiple-producer/single-consumer scenario, but with an upper bound on
+    // memory use. Enqueue and dequeue operations never take a lock. The mutex and
+    // wait handles are only used to park the consumer in WaitForData when there is
+    // nothing left to process, and producers of a full queue with the block policy.
+    //
+    // Each slot carries a sequence number that tells producers and consumers whether
+    // the slot is ready to be written or read, which allows the drop-oldest policy to
+    // safely discard items from a producer thread.
+    template<class T>
+    class RingBuffer // NOLINT
+    {
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> Sequence;
+            T Item;
+        };
+
+        static const size_t CacheLineSize = 64;
+
+        std::vector<Slot> m_slots;
+        size_t m_mask;
+        QueueOverflowPolicy m_overflowPolicy;
+
+        alignas(CacheLineSize) std::atomic<size_t> m_enqueuePosition;
+        alignas(CacheLineSize) std::atomic<size_t> m_dequeuePosition;
+        alignas(CacheLineSize) std::atomic<uint64_t> m_droppedCount;
+        std::atomic<bool> m_consumerWaiting;
+        std::atomic<uint32_t> m_producersWaiting;
+        std::atomic<bool> m_release;
+
+        Mutex m_mutex;
+        WaitHandle m_dataWaitHandle;
+        WaitHandle m_spaceWaitHandle;
+        boost::thread::id m_consumerThreadID;
+
+        void NotifyConsumer();
+        void NotifyProducers();
+        bool HasData() const;
+        bool HasSpace() const;
+        bool WaitForSpace();
+
+        static size_t GetSlotCount(uint32_t capacity);
+
+    public:
+        // Creates a new instance. Capacity is rounded
+        // up to the next power of two.
+        RingBuffer(uint32_t capacity, QueueOverflowPolicy overflowPolicy = QueueOverflowPolicy::DropOldest);
+
+        // Releases all threads waiting for data.
+        ~RingBuffer();
+
+        // Attempts to insert an item into the queue without applying the overflow policy.
+        // Item is only moved from when the operation succeeds. Returns false if full.
+        bool TryEnqueue(T&& item);
+
+        // Inserts an item into the queue, applying the overflow policy when
+        // the queue is full. Returns false if the item itself was dropped.
+        bool Enqueue(T item);
+
+        // Attempts to remove an item from the queue.
+        // Returns false if the queue is empty.
+        bool TryDequeue(T& item);
+
+        // Removes up to maxCount items from the queue, appending them to the given vector.
+        // Published items at the head of the queue are claimed together, so the dequeue
+        // position is only advanced once per call. Returns the number of items removed.
+        uint32_t TryDequeueBulk(std::vector<T>& items, uint32_t maxCount);
+
+        // Empties the queue.
+        void Clear();
+
+        // Returns the approximate number
+        // of items left in the queue.
+        uint32_t Size() const;
+
+        // Gets the maximum number of items the queue can hold.
+        uint32_t Capacity() const;
+
+        // Gets the policy applied when the queue is full.
+        QueueOverflowPolicy GetOverflowPolicy() const;
+
+        // Gets the total number of items
+        // discarded due to queue overflow.
+        uint64_t GetDroppedCount() const;
+
+        // Waits for data to be inserted into the queue.
+        // If there is already data in the queue,
+        // this method will not wait.
+        //
+        // Since the queue was designed for only a single consumer,
+        // calling this method from multiple threads may have undesired effects.
+        // The calling thread is taken to be the consumer of the queue.
+        void WaitForData();
+
+        // Releases all threads waiting for data or space.
+        //
+        // Further calls to WaitForData will not wait regardless of the amount
+        // of data in the queue. To make the queue usable again, call Reset.
+        void Release();
+
+        // Resets the "release valve" for threads calling WaitForData.
+        void Reset();
+    };
+
+    template<class T>
+    RingBuffer<T>::RingBuffer(uint32_t capacity, QueueOverflowPolicy overflowPolicy) :
+        m_slots(GetSlotCount(capacity)),
+        m_mask(m_slots.size() - 1),
+        m_overflowPolicy(overflowPolicy),
+        m_enqueuePosition(0),
+        m_dequeuePosition(0),
+        m_droppedCount(0),
+        m_consumerWaiting(false),
+        m_producersWaiting(0),
+        m_release(false)
+    {
+        for (size_t i = 0; i < m_slots.size(); i++)
+            m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Releases all threads waiting for data.
+    template<class T>
+    RingBuffer<T>::~RingBuffer()
+    {
+        Release();
+    }
+
+    // Rounds the requested capacity up to the next power of two
+    // so that slot positions can be calculated with a simple mask.
+    template<class T>
+    size_t RingBuffer<T>::GetSlotCount(uint32_t capacity)
+    {
+        size_t count = 2;
+
+        while (count < capacity)
+            count <<= 1;
+
+        return count;
+    }
+
+    // Wakes the consumer if it is parked in WaitForData. The fence pairs with the
+    // one in WaitForData so that either the producer sees the waiting flag or the
+    // consumer sees the newly published item.
+    template<class T>
+    void RingBuffer<T>::NotifyConsumer()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_consumerWaiting.load(std::memory_order_relaxed))
+        {
+            ScopeLock lock(m_mutex);
+            m_dataWaitHandle.notify_one();
+        }
+    }
+
+    // Wakes producers parked in WaitForSpace, if any, once slots have been freed.
+    // The fence pairs with the one in WaitForSpace in the same way as NotifyConsumer.
+    template<class T>
+    void RingBuffer<T>::NotifyProducers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_producersWaiting.load(std::memory_order_relaxed) > 0)
+        {
+            ScopeLock lock(m_mutex);
+            m_spaceWaitHandle.notify_all();
+        }
+    }
+
+    // Determines if the slot at the head of the queue has been published.
+    template<class T>
+    bool RingBuffer<T>::HasData() const
+    {
+        const size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        const size_t sequence = m_slots[position & m_mask].Sequence.load(std::memory_order_acquire);
+        return sequence == position + 1;
+    }
+
+    // Determines if the slot at the tail of the queue is free to be written.
+    template<class T>
+    bool RingBuffer<T>::HasSpace() const
+    {
+        const size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        const size_t sequence = m_slots[position & m_mask].Sequence.load(std::memory_order_acquire);
+        return static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position) >= 0;
+    }
+
+    // Parks a producer until the consumer frees a slot or the queue is released. Returns false
+    // without waiting when called from the consumer thread, which would otherwise wait on itself.
+    template<class T>
+    bool RingBuffer<T>::WaitForSpace()
+    {
+        UniqueLock lock(m_mutex);
+
+        if (m_consumerThreadID == boost::this_thread::get_id())
+            return false;
+
+        ++m_producersWaiting;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        while (!HasSpace() && !m_release.load(std::memory_order_relaxed))
+            m_spaceWaitHandle.wait(lock);
+
+        --m_producersWaiting;
+
+        return true;
+    }
+
+    // Attempts to insert an item into the queue without applying the overflow policy.
+    template<class T>
+    bool RingBuffer<T>::TryEnqueue(T&& item)
+    {
+        size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        while (true)
+        {
+            slot = &m_slots[position & m_mask];
+            const size_t sequence = slot->Sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->Item = std::move(item);
+        slot->Sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Inserts an item into the queue, applying the overflow policy when the queue is full.
+    template<class T>
+    bool RingBuffer<T>::Enqueue(T item)
+    {
+        bool enqueued = TryEnqueue(std::move(item));
+
+        while (!enqueued)
+        {
+            if (m_release.load(std::memory_order_relaxed))
+            {
+                ++m_droppedCount;
+                return false;
+            }
+
+            switch (m_overflowPolicy)
+            {
+                case QueueOverflowPolicy::Block:
+                    if (!WaitForSpace())
+                    {
+                        ++m_droppedCount;
+                        return false;
+                    }
+
+                    break;
+                case QueueOverflowPolicy::DropOldest:
+                {
+                    T discarded;
+
+                    if (TryDequeue(discarded))
+                        ++m_droppedCount;
+
+                    break;
+                }
+                case QueueOverflowPolicy::DropNewest:
+                    ++m_droppedCount;
+                    return false;
+            }
+
+            enqueued = TryEnqueue(std::move(item));
+        }
+
+        NotifyConsumer();
+        return true;
+    }
+
+    // Attempts to remove an item from the queue.
+    template<class T>
+    bool RingBuffer<T>::TryDequeue(T& item)
+    {
+        size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        while (true)
+        {
+            slot = &m_slots[position & m_mask];
+            const size_t sequence = slot->Sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Leave a default item in the slot so that any
+        // resources held by the dequeued item are not retained
+        item = std::move(slot->Item);
+        slot->Item = T();
+        slot->Sequence.store(position + m_mask + 1, std::memory_order_release);
+
+        NotifyProducers();
+        return true;
+    }
+
+    // Removes up to maxCount items from the queue, appending them to the given vector.
+    template<class T>
+    uint32_t RingBuffer<T>::TryDequeueBulk(std::vector<T>& items, uint32_t maxCount)
+    {
+        size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        uint32_t count;
+
+        while (true)
+        {
+            // Count the published items at the head of the queue, a slot only becomes
+            // free again after the dequeue position has been moved past it
+            count = 0;
+
+            while (count < maxCount && count < m_slots.size())
+            {
+                const size_t slotPosition = position + count;
+                const size_t sequence = m_slots[slotPosition & m_mask].Sequence.load(std::memory_order_acquire);
+
+                if (sequence != slotPosition + 1)
+                    break;
+
+                count++;
+            }
+
+            if (count == 0)
+                return 0;
+
+            // Claim the whole range, retry from the new head if another thread dequeued first
+            if (m_dequeuePosition.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+                break;
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Slot& slot = m_slots[(position + i) & m_mask];
+            items.push_back(std::move(slot.Item));
+            slot.Item = T();
+            slot.Sequence.store(position + i + m_mask + 1, std::memory_order_release);
+        }
+
+        NotifyProducers();
+        return count;
+    }
+
+    // Empties the queue.
+    template<class T>
+    void RingBuffer<T>::Clear()
+    {
+        T item;
+
+        while (TryDequeue(item))
+        {
+        }
+    }
+
+    // Returns the approximate number
+    // of items left in the queue.
+    template<class T>
+    uint32_t RingBuffer<T>::Size() const
+    {
+        const size_t dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+        const size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+        return enqueuePosition > dequeuePosition ? static_cast<uint32_t>(enqueuePosition - dequeuePosition) : 0U;
+    }
+
+    // Gets the maximum number of items the queue can hold.
+    template<class T>
+    uint32_t RingBuffer<T>::Capacity() const
+    {
+        return static_cast<uint32_t>(m_slots.size());
+    }
+
+    // Gets the policy applied when the queue is full.
+    template<class T>
+    QueueOverflowPolicy RingBuffer<T>::GetOverflowPolicy() const
+    {
+        return m_overflowPolicy;
+    }
+
+    // Gets the total number of items
+    // discarded due to queue overflow.
+    template<class T>
+    uint64_t RingBuffer<T>::GetDroppedCount() const
+    {
+        return m_droppedCount.load(std::memory_order_relaxed);
+    }
+
+    // Waits for data to be inserted into the queue.
+    // If there is already data in the queue,
+    // this method will not wait.
+    template<class T>
+    void RingBuffer<T>::WaitForData()
+    {
+        UniqueLock lock(m_mutex);
+
+        m_consumerThreadID = boost::this_thread::get_id();
+        m_consumerWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        while (!HasData() && !m_release.load(std::memory_order_relaxed))
+            m_dataWaitHandle.wait(lock);
+
+        m_consumerWaiting.store(false, std::memory_order_relaxed);
+    }
+
+    // Releases all threads waiting for data or space.
+    template<class T>
+    void RingBuffer<T>::Release()
+    {
+        ScopeLock lock(m_mutex);
+
+        m_release = true;
+        m_dataWaitHandle.notify_all();
+        m_spaceWaitHandle.notify_all();
+    }
+
+    // Resets the "release valve" for threads calling WaitForData.
+    // This can be called after Release so that the queue can be
+    // used again.
+    template<class T>
+    void RingBuffer<T>::Reset()
+    {
+        ScopeLock lock(m_mutex);
+        m_release = false;
+    }
+}
+
+#endif
@@ -62,6 +62,13 @@ namespace GSF
         // queue and returns that item.
         T Dequeue();
 
+        // Removes all items from the queue in a single
+        // operation, swapping them into the given queue.
+        //
+        // The provided queue should be empty. Its storage is
+        // given to this queue so that it can be reused.
+        void DequeueAll(std::queue<T>& items);
+
         // Empties the queue.
         void Clear();
 
@@ -99,7 +106,7 @@ namespace GSF
     void ThreadSafeQueue<T>::Enqueue(T item)
     {
         ScopeLock lock(m_mutex);
-        m_queue.push(item);
+        m_queue.push(std::move(item));
         m_dataWaitHandle.notify_one();
     }
 
@@ -114,6 +121,15 @@ namespace GSF
         return item;
     }
 
+    // Removes all items from the queue in a single
+    // operation, swapping them into the given queue.
+    template<class T>
+    void ThreadSafeQueue<T>::DequeueAll(std::queue<T>& items)
+    {
+        ScopeLock lock(m_mutex);
+        m_queue.swap(items);
+    }
+
     // Empties the queue.
     template<class T>
     void ThreadSafeQueue<T>::Clear()
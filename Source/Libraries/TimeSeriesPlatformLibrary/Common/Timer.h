@@ -25,56 +25,32 @@
 #define _TIMER_H
 
 #include "CommonTypes.h"
+#include "TimerScheduler.h"
 
 namespace GSF
 {
     class Timer;
     typedef std::function<void(Timer* timer, void* userData)> TimerElapsedCallback;
 
+    // Timer that raises its callback after an interval, optionally repeating.
+    //
+    // Timers do not own a thread, all timers are run by the shared TimerScheduler, so
+    // callbacks of different timers are raised one at a time on the scheduler thread.
+    // Destroying a timer waits for its callback to complete when it is running on
+    // another thread.
     class Timer // NOLINT
     {
     private:
-        GSF::Thread* m_timerThread;
-        GSF::IOContext m_timerContext;
-        boost::asio::deadline_timer m_timer;
+        TimerSchedulerPtr m_scheduler;
+        uint64_t m_timerID;
         int32_t m_interval;
         TimerElapsedCallback m_callback;
         void* m_userData;
         bool m_autoReset;
-        bool m_disposing;
 
-        void TimerThread()
+        void TimerElaspsed()
         {
-            try
-            {
-                // Running context will block while items are queued to execute
-                m_timerContext.run();
-            }
-            catch (...)
-            {
-                return;
-            }
-
-            if (m_disposing)
-                return;
-
-            // Reset timer thread when context has nothing left to run
-            delete m_timerThread;
-            m_timerThread = nullptr;
-
-            // Restart context in preparation for next run
-            m_timerContext.restart();
-        }
-
-        void TimerElaspsed(const GSF::ErrorCode& error)
-        {
-            if (error)
-                return;
-
             m_callback(this, m_userData);
-
-            if (m_autoReset)
-                Start();
         }
 
     public:
@@ -83,22 +59,18 @@ namespace GSF
         }
 
         Timer(const int32_t interval, const TimerElapsedCallback& callback, const bool autoReset = false) :
-            m_timerThread(nullptr),
-            m_timer(m_timerContext),
+            m_scheduler(TimerScheduler::Default()),
             m_interval(interval),
             m_callback(callback),
             m_userData(nullptr),
-            m_autoReset(autoReset),
-            m_disposing(false)
+            m_autoReset(autoReset)
         {
+            m_timerID = m_scheduler->Register(boost::bind(&Timer::TimerElaspsed, this));
         }
 
         ~Timer()
         {
-            m_disposing = true;
-            delete m_timerThread;
-            m_timerThread = nullptr;
-            Stop();
+            m_scheduler->Unregister(m_timerID);
         }
 
         int32_t GetInterval() const
@@ -106,9 +78,11 @@ namespace GSF
             return m_interval;
         }
 
+        // New interval takes effect the next time the timer is started or auto-reset
         void SetInterval(const int32_t value)
         {
             m_interval = value;
+            m_scheduler->SetInterval(m_timerID, value);
         }
 
         TimerElapsedCallback GetCallback() const
@@ -146,20 +120,16 @@ namespace GSF
             if (m_callback == nullptr)
                 throw std::invalid_argument("Cannot start timer, no callback function has been defined.");
 
-            m_timer.expires_from_now(boost::posix_time::milliseconds(m_interval));
-            m_timer.async_wait(boost::bind(&Timer::TimerElaspsed, this, boost::asio::placeholders::error));
-
-            if (m_timerThread == nullptr)
-                m_timerThread = new GSF::Thread(boost::bind(&Timer::TimerThread, this));
+            m_scheduler->Schedule(m_timerID, m_interval, m_autoReset);
         }
 
         void Stop()
         {
-            m_timer.cancel();
+            m_scheduler->Cancel(m_timerID);
         }
     };
 
     typedef GSF::SharedPtr<Timer> TimerPtr;
 }
 
-#endif
\ No newline at end of file
+#endif
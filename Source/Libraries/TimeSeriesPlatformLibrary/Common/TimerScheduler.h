@@ -0,0 +1,274 @@
+//******************************************************************************************************
+//  TimerScheduler.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TIMER_SCHEDULER_H
+#define __TIMER_SCHEDULER_H
+
+#include "CommonTypes.h"
+#include <boost/chrono.hpp>
+#include <set>
+
+namespace GSF
+{
+    class TimerScheduler;
+    typedef GSF::SharedPtr<TimerScheduler> TimerSchedulerPtr;
+
+    // Runs the callbacks of any number of timers on a single shared thread.
+    //
+    // Scheduled callbacks are ordered by due time, so scheduling, cancelling and
+    // firing a callback are logarithmic in the number of scheduled callbacks.
+    // Callbacks run one at a time on the scheduler thread and should return
+    // quickly so that other callbacks are not delayed.
+    class TimerScheduler // NOLINT
+    {
+    public:
+        typedef std::function<void()> ScheduledCallback;
+
+    private:
+        typedef boost::chrono::steady_clock Clock;
+        typedef std::pair<Clock::time_point, uint64_t> ScheduleKey;
+
+        struct ScheduledEntry
+        {
+            ScheduledCallback Callback;
+            Clock::time_point DueTime;
+            int32_t Interval;
+            bool Repeat;
+            bool Scheduled;
+            bool Unregistered;
+        };
+
+        std::unordered_map<uint64_t, ScheduledEntry> m_entries;
+        std::set<ScheduleKey> m_schedule;
+        uint64_t m_nextID;
+        uint64_t m_firingID;
+        Mutex m_lock;
+        WaitHandle m_scheduleChanged;
+        WaitHandle m_callbackCompleted;
+        Thread m_thread;
+        bool m_disposing;
+
+        void Unschedule(uint64_t id, ScheduledEntry& entry)
+        {
+            if (entry.Scheduled)
+                m_schedule.erase(ScheduleKey(entry.DueTime, id));
+
+            entry.Scheduled = false;
+        }
+
+        void Reschedule(uint64_t id, ScheduledEntry& entry)
+        {
+            Unschedule(id, entry);
+
+            entry.DueTime = Clock::now() + boost::chrono::milliseconds(entry.Interval);
+            entry.Scheduled = true;
+
+            const auto position = m_schedule.insert(ScheduleKey(entry.DueTime, id)).first;
+
+            // Wake scheduler thread when the new entry is due before any other
+            if (position == m_schedule.begin())
+                m_scheduleChanged.notify_one();
+        }
+
+        bool IsSchedulerThread() const
+        {
+            return boost::this_thread::get_id() == m_thread.get_id();
+        }
+
+        void SchedulerThread()
+        {
+            UniqueLock lock(m_lock);
+
+            while (!m_disposing)
+            {
+                if (m_schedule.empty())
+                {
+                    m_scheduleChanged.wait(lock);
+                    continue;
+                }
+
+                const ScheduleKey next = *m_schedule.begin();
+
+                if (Clock::now() < next.first)
+                {
+                    m_scheduleChanged.wait_until(lock, next.first);
+                    continue;
+                }
+
+                m_schedule.erase(m_schedule.begin());
+
+                ScheduledEntry& entry = m_entries[next.second];
+                entry.Scheduled = false;
+
+                // Entry, and its callback, remain valid until the callback completes
+                m_firingID = next.second;
+                lock.unlock();
+
+                try
+                {
+                    entry.Callback();
+                }
+                catch (...)
+                {
+                    // Callback exceptions must not stop other timers
+                }
+
+                lock.lock();
+                m_firingID = 0;
+
+                if (entry.Unregistered)
+                    m_entries.erase(next.second);
+                else if (entry.Repeat && !entry.Scheduled)
+                    Reschedule(next.second, entry);
+
+                m_callbackCompleted.notify_all();
+            }
+        }
+
+    public:
+        // Creates a new scheduler and starts its thread.
+        TimerScheduler() :
+            m_nextID(1),
+            m_firingID(0),
+            m_disposing(false)
+        {
+            m_thread = Thread(boost::bind(&TimerScheduler::SchedulerThread, this));
+        }
+
+        // Stops the scheduler thread, pending callbacks are not run.
+        ~TimerScheduler()
+        {
+            m_lock.lock();
+            m_disposing = true;
+            m_scheduleChanged.notify_one();
+            m_lock.unlock();
+
+            if (IsSchedulerThread())
+                m_thread.detach();
+            else
+                m_thread.join();
+        }
+
+        // Registers a callback and returns the identifier used to schedule it.
+        uint64_t Register(const ScheduledCallback& callback)
+        {
+            ScopeLock lock(m_lock);
+            const uint64_t id = m_nextID++;
+            ScheduledEntry& entry = m_entries[id];
+
+            entry.Callback = callback;
+            entry.Interval = 0;
+            entry.Repeat = false;
+            entry.Scheduled = false;
+            entry.Unregistered = false;
+
+            return id;
+        }
+
+        // Removes a registered callback. Waits for the callback to complete when it is running on
+        // another thread, so that anything the callback references may be safely destroyed after.
+        void Unregister(uint64_t id)
+        {
+            UniqueLock lock(m_lock);
+            const auto iterator = m_entries.find(id);
+
+            if (iterator == m_entries.end())
+                return;
+
+            Unschedule(id, iterator->second);
+
+            if (m_firingID == id)
+            {
+                // Callback is unregistering itself, entry is removed once it returns
+                if (IsSchedulerThread())
+                {
+                    iterator->second.Unregistered = true;
+                    return;
+                }
+
+                while (m_firingID == id)
+                    m_callbackCompleted.wait(lock);
+            }
+
+            m_entries.erase(id);
+        }
+
+        // Schedules a registered callback to run after the given interval, in milliseconds,
+        // replacing any pending schedule. Repeating callbacks are rescheduled by the same
+        // interval each time they complete, until cancelled.
+        void Schedule(uint64_t id, int32_t interval, bool repeat)
+        {
+            ScopeLock lock(m_lock);
+            const auto iterator = m_entries.find(id);
+
+            if (iterator == m_entries.end() || iterator->second.Unregistered)
+                return;
+
+            iterator->second.Interval = interval;
+            iterator->second.Repeat = repeat;
+            Reschedule(id, iterator->second);
+        }
+
+        // Changes the interval of a registered callback, taking effect when it is next
+        // rescheduled. A pending schedule keeps its current due time.
+        void SetInterval(uint64_t id, int32_t interval)
+        {
+            ScopeLock lock(m_lock);
+            const auto iterator = m_entries.find(id);
+
+            if (iterator != m_entries.end())
+                iterator->second.Interval = interval;
+        }
+
+        // Cancels any pending schedule of a registered callback, a callback that
+        // is currently running completes but will not be run again.
+        void Cancel(uint64_t id)
+        {
+            ScopeLock lock(m_lock);
+            const auto iterator = m_entries.find(id);
+
+            if (iterator == m_entries.end())
+                return;
+
+            Unschedule(id, iterator->second);
+            iterator->second.Repeat = false;
+        }
+
+        // Gets the number of registered callbacks.
+        uint32_t Count()
+        {
+            ScopeLock lock(m_lock);
+            return static_cast<uint32_t>(m_entries.size());
+        }
+
+        // Gets the scheduler shared by all timers. References are held by the timers
+        // themselves so the scheduler outlives any timer destroyed during shutdown.
+        static const TimerSchedulerPtr& Default()
+        {
+            static TimerSchedulerPtr scheduler = NewSharedPtr<TimerScheduler>();
+            return scheduler;
+        }
+    };
+}
+
+#endif
@@ -26,6 +26,13 @@
 
 #include "../Common/CommonTypes.h"
 
+namespace GSF {
+namespace FilterExpressions
+{
+    class ExpressionTree;
+    typedef GSF::SharedPtr<ExpressionTree> ExpressionTreePtr;
+}}
+
 namespace GSF {
 namespace Data
 {
@@ -67,6 +74,10 @@ namespace Data
         bool m_computed;
         int32_t m_index;
 
+        // Expression tree of a computed column, parsed once and shared by all rows
+        GSF::FilterExpressions::ExpressionTreePtr m_expressionTree;
+        GSF::Mutex m_expressionTreeLock;
+
     public:
         DataColumn(DataTablePtr parent, std::string name, DataType type, std::string expression = std::string{});
         ~DataColumn();
@@ -86,6 +97,7 @@ namespace Data
         static const DataColumnPtr NullPtr;
 
         friend class DataTable;
+        friend class DataRow;
     };
 }}
 
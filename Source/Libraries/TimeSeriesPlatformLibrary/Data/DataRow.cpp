@@ -37,7 +37,8 @@ const DataRowPtr DataRow::NullPtr = nullptr;
 
 DataRow::DataRow(DataTablePtr parent) :
     m_parent(std::move(parent)),
-    m_values(m_parent->ColumnCount())
+    m_values(m_parent->ColumnCount()),
+    m_added(false)
 {
     if (m_parent == nullptr)
         throw DataSetException("DataTable parent is null");
@@ -49,14 +50,7 @@ DataRow::DataRow(DataTablePtr parent) :
 DataRow::~DataRow()
 {
     for (uint32_t i = 0; i < m_values.size(); i++)
-    {
-        const DataColumnPtr column = m_parent->Column(i);
-
-        if (column != nullptr && column->Computed())
-            delete static_cast<FilterExpressionParser*>(m_values[i]);
-        else
-            free(m_values[i]);
-    }
+        free(m_values[i]);
 }
 
 int32_t DataRow::GetColumnIndex(const string& columnName) const
@@ -91,42 +85,29 @@ DataColumnPtr DataRow::ValidateColumnType(const int32_t columnIndex, DataType ta
     return column;
 }
 
-ExpressionTreePtr DataRow::GetExpressionTree(const DataColumnPtr& column)
+ExpressionTreePtr DataRow::GetExpressionTree(const DataColumnPtr& column) const
 {
-    const int columnIndex = column->Index();
-
-    if (m_values[columnIndex] == nullptr)
+    // Computed column expression is parsed on first use and shared by all rows of the column
+    if (column->m_expressionTree == nullptr)
     {
-        const DataTablePtr& dataTable = column->Parent();
-        FilterExpressionParser* parser = new FilterExpressionParser(column->Expression());
-
-        parser->SetDataSet(dataTable->Parent());
-        parser->SetPrimaryTableName(dataTable->Name());
-        parser->SetTrackFilteredSignalIDs(false);
-        parser->SetTrackFilteredRows(false);
-
-        const auto expressionTrees = parser->GetExpressionTrees();
+        const vector<ExpressionTreePtr> expressionTrees = FilterExpressionParser::GenerateExpressionTrees(column->Parent(), column->Expression());
 
         if (expressionTrees.empty())
-        {
-            delete parser;
             throw DataSetException("Expression defined for computed DataColumn \"" + column->Name() + " for table \"" + m_parent->Name() + "\" cannot produce a value");
-        }
-
-        m_values[columnIndex] = parser;
 
-        return expressionTrees[0];
+        column->m_expressionTree = expressionTrees[0];
     }
 
-   return static_cast<FilterExpressionParser*>(m_values[columnIndex])->GetExpressionTrees()[0];
+    return column->m_expressionTree;
 }
 
 Object DataRow::GetComputedValue(const DataColumnPtr& column, DataType targetType)
 {
     try
     {
-        const ExpressionTreePtr& expressionTree = GetExpressionTree(column);
-        const ValueExpressionPtr& sourceValue = expressionTree->Evaluate(shared_from_this());
+        // Shared expression tree tracks the row being evaluated, so evaluations are serialized per column
+        ScopeLock lock(column->m_expressionTreeLock);
+        const ValueExpressionPtr sourceValue = GetExpressionTree(column)->Evaluate(shared_from_this());
 
         switch (sourceValue->ValueType)
         {
@@ -600,6 +581,11 @@ void DataRow::SetNullValue(const string& columnName)
     SetNullValue(GetColumnIndex(columnName));
 }
 
+const void* DataRow::RawValue(const int32_t columnIndex) const
+{
+    return m_values[columnIndex];
+}
+
 Nullable<string> DataRow::ValueAsString(const int32_t columnIndex)
 {
     const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::String, true);
@@ -624,6 +610,10 @@ void DataRow::SetStringValue(const int32_t columnIndex, const Nullable<string>&
 {
     ValidateColumnType(columnIndex, DataType::String);
 
+    // Updates to rows already added to the table invalidate any column index
+    if (m_added)
+        m_parent->InvalidateIndex(columnIndex);
+
     // Free any existing value on updates
     free(m_values[columnIndex]);
 
@@ -826,6 +816,10 @@ void DataRow::SetGuidValue(const int32_t columnIndex, const Nullable<GSF::Guid>&
 {
     ValidateColumnType(columnIndex, DataType::Guid);
 
+    // Updates to rows already added to the table invalidate any column index
+    if (m_added)
+        m_parent->InvalidateIndex(columnIndex);
+
     // Free any existing value on updates
     free(m_values[columnIndex]);
 
@@ -54,11 +54,13 @@ namespace Data
     private:
         DataTablePtr m_parent;
         std::vector<void*> m_values;
+        bool m_added;
 
         int32_t GetColumnIndex(const std::string& columnName) const;
         DataColumnPtr ValidateColumnType(int32_t columnIndex, DataType targetType, bool read = false) const;
 
-        GSF::FilterExpressions::ExpressionTreePtr GetExpressionTree(const DataColumnPtr& column);
+        // Caller must hold the column's expression tree lock
+        GSF::FilterExpressions::ExpressionTreePtr GetExpressionTree(const DataColumnPtr& column) const;
         GSF::Object GetComputedValue(const DataColumnPtr& column, DataType targetType);
 
         template<class T>
@@ -77,6 +79,11 @@ namespace Data
         void SetNullValue(int32_t columnIndex);
         void SetNullValue(const std::string& columnName);
 
+        // Gets the stored value of a non-computed column without type validation or copying, or
+        // nullptr when value is Null. Value is held in its native column type, strings are null
+        // terminated and booleans are stored as a byte. Pointer is invalidated by value updates.
+        const void* RawValue(int32_t columnIndex) const;
+
         GSF::Nullable<std::string> ValueAsString(int32_t columnIndex);
         GSF::Nullable<std::string> ValueAsString(const std::string& columnName);
         void SetStringValue(int32_t columnIndex, const GSF::Nullable<std::string>& value);
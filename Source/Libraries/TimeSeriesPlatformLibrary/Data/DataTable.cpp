@@ -55,6 +55,7 @@ void DataTable::AddColumn(DataColumnPtr column)
     column->m_index = m_columns.size();
     m_columnIndexes.insert(pair<string, int32_t>(column->Name(), column->m_index));
     m_columns.push_back(std::move(column));
+    m_indexes.push_back(nullptr);
 }
 
 const DataColumnPtr& DataTable::Column(const string& columnName) const
@@ -110,7 +111,22 @@ const DataRowPtr& DataTable::Row(int32_t index)
 
 void DataTable::AddRow(DataRowPtr row)
 {
+    const int32_t rowIndex = m_rows.size();
+
+    if (row != nullptr)
+        row->m_added = true;
+
     m_rows.push_back(std::move(row));
+
+    ScopeLock lock(m_indexLock);
+
+    for (size_t i = 0; i < m_indexes.size(); i++)
+    {
+        const ColumnIndexPtr& index = m_indexes[i];
+
+        if (index != nullptr && !index->Stale)
+            IndexRow(*index, i, rowIndex);
+    }
 }
 
 DataRowPtr DataTable::CreateRow()
@@ -183,3 +199,121 @@ int32_t DataTable::RowCount() const
 {
     return m_rows.size();
 }
+
+void DataTable::CreateIndex(const int32_t columnIndex)
+{
+    const DataColumnPtr& column = Column(columnIndex);
+
+    if (column == nullptr)
+        throw DataSetException("Column index " + ToString(columnIndex) + " is out of range for table \"" + m_name + "\"");
+
+    if (column->Computed() || (column->Type() != DataType::String && column->Type() != DataType::Guid))
+        throw DataSetException("Cannot index DataColumn \"" + column->Name() + "\" for table \"" + m_name + "\", only string and Guid columns can be indexed");
+
+    ScopeLock lock(m_indexLock);
+
+    if (m_indexes[columnIndex] != nullptr)
+        return;
+
+    const ColumnIndexPtr index = NewSharedPtr<ColumnIndex>();
+    RebuildIndex(*index, columnIndex);
+    m_indexes[columnIndex] = index;
+}
+
+void DataTable::CreateIndex(const string& columnName)
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column == nullptr)
+        throw DataSetException("Column name \"" + columnName + "\" was not found in table \"" + m_name + "\"");
+
+    CreateIndex(column->Index());
+}
+
+bool DataTable::HasIndex(const int32_t columnIndex) const
+{
+    ScopeLock lock(m_indexLock);
+    return columnIndex >= 0 && columnIndex < static_cast<int32_t>(m_indexes.size()) && m_indexes[columnIndex] != nullptr;
+}
+
+bool DataTable::TryFindRows(const int32_t columnIndex, const string& value, vector<int32_t>& rowIndexes)
+{
+    const DataColumnPtr& column = Column(columnIndex);
+
+    if (column == nullptr || column->Type() != DataType::String)
+        return false;
+
+    return FindIndexedRows(columnIndex, ToUpper(value), rowIndexes);
+}
+
+bool DataTable::TryFindRows(const int32_t columnIndex, const GSF::Guid& value, vector<int32_t>& rowIndexes)
+{
+    const DataColumnPtr& column = Column(columnIndex);
+
+    if (column == nullptr || column->Type() != DataType::Guid)
+        return false;
+
+    return FindIndexedRows(columnIndex, string(reinterpret_cast<const char*>(value.data), 16), rowIndexes);
+}
+
+// Index is checked under the same lock as the lookup, so an index created concurrently by
+// another thread, e.g., a parser on another connection, is either seen complete or not at all
+bool DataTable::FindIndexedRows(const int32_t columnIndex, const string& key, vector<int32_t>& rowIndexes)
+{
+    ScopeLock lock(m_indexLock);
+    const ColumnIndexPtr& indexPtr = m_indexes[columnIndex];
+
+    if (indexPtr == nullptr)
+        return false;
+
+    ColumnIndex& index = *indexPtr;
+
+    if (index.Stale)
+        RebuildIndex(index, columnIndex);
+
+    const auto iterator = index.RowIndexes.find(key);
+
+    if (iterator != index.RowIndexes.end())
+        rowIndexes.insert(rowIndexes.end(), iterator->second.begin(), iterator->second.end());
+
+    return true;
+}
+
+void DataTable::IndexRow(ColumnIndex& index, const int32_t columnIndex, const int32_t rowIndex) const
+{
+    const DataRowPtr& row = m_rows[rowIndex];
+
+    if (row == nullptr)
+        return;
+
+    const char* value = static_cast<const char*>(row->RawValue(columnIndex));
+
+    // Null values are not indexed
+    if (value == nullptr)
+        return;
+
+    // String keys are upper case to match values ignoring case, Guid keys are the raw bytes
+    if (m_columns[columnIndex]->Type() == DataType::String)
+        index.RowIndexes[ToUpper(value)].push_back(rowIndex);
+    else
+        index.RowIndexes[string(value, 16)].push_back(rowIndex);
+}
+
+void DataTable::RebuildIndex(ColumnIndex& index, const int32_t columnIndex) const
+{
+    index.RowIndexes.clear();
+    index.Stale = false;
+
+    for (size_t i = 0; i < m_rows.size(); i++)
+        IndexRow(index, columnIndex, i);
+}
+
+void DataTable::InvalidateIndex(const int32_t columnIndex)
+{
+    ScopeLock lock(m_indexLock);
+
+    if (columnIndex < 0 || columnIndex >= static_cast<int32_t>(m_indexes.size()) || m_indexes[columnIndex] == nullptr)
+        return;
+
+    m_indexes[columnIndex]->Stale = true;
+}
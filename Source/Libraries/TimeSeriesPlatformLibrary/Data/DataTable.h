@@ -42,11 +42,27 @@ namespace Data
     class DataTable : public GSF::EnableSharedThisPtr<DataTable> // NOLINT
     {
     private:
+        // Hash index of row indexes, in table order, keyed by column value
+        struct ColumnIndex
+        {
+            std::unordered_map<std::string, std::vector<int32_t>> RowIndexes;
+            bool Stale;
+        };
+
+        typedef GSF::SharedPtr<ColumnIndex> ColumnIndexPtr;
+
         DataSetPtr m_parent;
         std::string m_name;
         GSF::StringMap<int32_t> m_columnIndexes;
         std::vector<DataColumnPtr> m_columns;
         std::vector<DataRowPtr> m_rows;
+        std::vector<ColumnIndexPtr> m_indexes;
+        mutable GSF::Mutex m_indexLock;
+
+        void IndexRow(ColumnIndex& index, int32_t columnIndex, int32_t rowIndex) const;
+        void RebuildIndex(ColumnIndex& index, int32_t columnIndex) const;
+        void InvalidateIndex(int32_t columnIndex);
+        bool FindIndexedRows(int32_t columnIndex, const std::string& key, std::vector<int32_t>& rowIndexes);
 
     public:
         DataTable(DataSetPtr parent, std::string name);
@@ -82,7 +98,22 @@ namespace Data
 
         int32_t RowCount() const;
 
+        // Creates a hash index of rows by the value of a string or Guid column, used to look up rows
+        // for equality and IN list filters. String values are indexed ignoring case. Index is kept
+        // current as rows are added and is rebuilt on next lookup after an added row is updated.
+        void CreateIndex(int32_t columnIndex);
+        void CreateIndex(const std::string& columnName);
+
+        bool HasIndex(int32_t columnIndex) const;
+
+        // Gets the indexes, in table order, of rows with the given value in an indexed column,
+        // string values are matched ignoring case. Returns false if column is not indexed.
+        bool TryFindRows(int32_t columnIndex, const std::string& value, std::vector<int32_t>& rowIndexes);
+        bool TryFindRows(int32_t columnIndex, const GSF::Guid& value, std::vector<int32_t>& rowIndexes);
+
         static const DataTablePtr NullPtr;
+
+        friend class DataRow;
     };
 
     typedef GSF::SharedPtr<DataTable> DataTablePtr;
@@ -22,7 +22,7 @@
 //******************************************************************************************************
 
 #include "ExpressionTree.h"
-#include <regex>
+#include <boost/algorithm/string.hpp>
 
 using namespace std;
 using namespace GSF;
@@ -444,6 +444,40 @@ FunctionExpression::FunctionExpression(const ExpressionFunctionType functionType
 {
 }
 
+LikePattern::LikePattern(const string& pattern)
+{
+    TestExpression = GSF::Replace(pattern, "%", "*", false);
+    StartsWithWildcard = GSF::StartsWith(TestExpression, "*", false);
+    EndsWithWildcard = GSF::EndsWith(TestExpression, "*", false);
+
+    if (StartsWithWildcard)
+        TestExpression = TestExpression.substr(1);
+
+    if (EndsWithWildcard && !TestExpression.empty())
+        TestExpression = TestExpression.substr(0, TestExpression.size() - 1);
+
+    // Wild cards in the middle of the string are not supported
+    IsValid = !GSF::Contains(TestExpression, "*", false);
+}
+
+bool LikePattern::IsMatch(const StringView& value, const bool ignoreCase) const
+{
+    // "*" or "**" expression means match everything
+    if (TestExpression.empty())
+        return true;
+
+    if (StartsWithWildcard && (ignoreCase ? boost::iends_with(value, TestExpression) : boost::ends_with(value, TestExpression)))
+        return true;
+
+    if (EndsWithWildcard && (ignoreCase ? boost::istarts_with(value, TestExpression) : boost::starts_with(value, TestExpression)))
+        return true;
+
+    if (StartsWithWildcard && EndsWithWildcard)
+        return ignoreCase ? boost::icontains(value, TestExpression) : boost::contains(value, TestExpression);
+
+    return false;
+}
+
 ValueExpressionPtr ExpressionTree::Evaluate(const ExpressionPtr& expression, const ExpressionValueType targetValueType) const
 {
     if (expression == nullptr)
@@ -2770,36 +2804,12 @@ ValueExpressionPtr ExpressionTree::Like(const ValueExpressionPtr& leftValue, con
 
     const string leftOperand = leftValue->ValueAsString();
     const string rightOperand = rightValue->ValueAsString();
+    const LikePattern& pattern = GetLikePattern(rightOperand);
 
-    string testExpression = GSF::Replace(rightOperand, "%", "*", false);
-    const bool startsWithWildcard = GSF::StartsWith(testExpression, "*", false);
-    const bool endsWithWildcard = GSF::EndsWith(testExpression, "*", false);
-    const bool ignoreCase = !exactMatch;
-
-    if (startsWithWildcard)
-        testExpression = testExpression.substr(1);
-
-    if (endsWithWildcard && !testExpression.empty())
-        testExpression = testExpression.substr(0, testExpression.size() - 1);
-
-    // "*" or "**" expression means match everything
-    if (testExpression.empty())
-        return ExpressionTree::True;
-
-    // Wild cards in the middle of the string are not supported
-    if (GSF::Contains(testExpression, "*", false))
+    if (!pattern.IsValid)
         throw ExpressionTreeException("Right operand of \"LIKE\" expression \"" + rightOperand + "\" has an invalid pattern");
 
-    if (startsWithWildcard && GSF::EndsWith(leftOperand, testExpression, ignoreCase))
-        return ExpressionTree::True;
-
-    if (endsWithWildcard && GSF::StartsWith(leftOperand, testExpression, ignoreCase))
-        return ExpressionTree::True;
-
-    if (startsWithWildcard && endsWithWildcard && GSF::Contains(leftOperand, testExpression, ignoreCase))
-        return ExpressionTree::True;
-
-    return ExpressionTree::False;
+    return pattern.IsMatch(leftOperand, !exactMatch) ? ExpressionTree::True : ExpressionTree::False;
 }
 
 ValueExpressionPtr ExpressionTree::NotLike(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, const bool exactMatch) const
@@ -3175,10 +3185,10 @@ ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, con
 
     const string expressionText = regexValue->ValueAsString();
     const string testText = testValue->ValueAsString();
-    const regex expression(expressionText);
+    const SharedPtr<regex>& expression = GetRegex(expressionText);
 
     cmatch match;
-    const bool result = regex_search(testText.c_str(), match, expression);
+    const bool result = regex_search(testText.c_str(), match, *expression);
 
     if (returnMatchedValue)
     {
@@ -3193,6 +3203,697 @@ ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, con
     return result ? ExpressionTree::True : ExpressionTree::False;
 }
 
+// Pattern caches are reset when full to bound memory use, e.g., for patterns read from rows
+static const size_t MaxCachedPatterns = 256;
+
+const LikePattern& ExpressionTree::GetLikePattern(const string& pattern) const
+{
+    auto iterator = m_likePatterns.find(pattern);
+
+    if (iterator == m_likePatterns.end())
+    {
+        if (m_likePatterns.size() >= MaxCachedPatterns)
+            m_likePatterns.clear();
+
+        iterator = m_likePatterns.emplace(pattern, LikePattern(pattern)).first;
+    }
+
+    return iterator->second;
+}
+
+const SharedPtr<regex>& ExpressionTree::GetRegex(const string& expressionText) const
+{
+    auto iterator = m_regexPatterns.find(expressionText);
+
+    if (iterator == m_regexPatterns.end())
+    {
+        if (m_regexPatterns.size() >= MaxCachedPatterns)
+            m_regexPatterns.clear();
+
+        // Construct expression before caching so an invalid pattern is not cached
+        SharedPtr<regex> expression = NewSharedPtr<regex>(expressionText);
+        iterator = m_regexPatterns.emplace(expressionText, std::move(expression)).first;
+    }
+
+    return iterator->second;
+}
+
+namespace
+{
+    // Compiled operand values are held as their native C++ type, except
+    // constant strings that are stored and read through a string view
+    template<class T>
+    struct CompiledValue
+    {
+        typedef T StorageType;
+    };
+
+    template<>
+    struct CompiledValue<StringView>
+    {
+        typedef string StorageType;
+    };
+
+    template<class T>
+    typename CompiledValue<T>::StorageType ConstantValue(const ValueExpressionPtr& value);
+
+    template<>
+    bool ConstantValue<bool>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsBoolean();
+    }
+
+    template<>
+    int32_t ConstantValue<int32_t>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsInt32();
+    }
+
+    template<>
+    int64_t ConstantValue<int64_t>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsInt64();
+    }
+
+    template<>
+    float64_t ConstantValue<float64_t>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsDouble();
+    }
+
+    template<>
+    string ConstantValue<StringView>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsString();
+    }
+
+    template<>
+    Guid ConstantValue<Guid>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsGuid();
+    }
+
+    template<>
+    DateTime ConstantValue<DateTime>(const ValueExpressionPtr& value)
+    {
+        return value->ValueAsDateTime();
+    }
+
+    // Undefined NULL values are evaluated as a Null of the target type
+    bool IsNullConstant(const ValueExpressionPtr& value)
+    {
+        return value->ValueType == ExpressionValueType::Undefined || value->IsNull();
+    }
+
+    template<class TNative, class T>
+    CompiledOperand<T> NativeColumnOperand(const int32_t columnIndex)
+    {
+        return [columnIndex](const DataRow& row, T& value)
+        {
+            const TNative* nativeValue = static_cast<const TNative*>(row.RawValue(columnIndex));
+
+            if (nativeValue == nullptr)
+                return false;
+
+            value = static_cast<T>(*nativeValue);
+            return true;
+        };
+    }
+
+    // Numeric and boolean column values are widened to the operation value type
+    template<class T>
+    CompiledOperand<T> ColumnOperand(const int32_t columnIndex, const DataType dataType)
+    {
+        switch (dataType)
+        {
+            case DataType::Boolean:
+                return NativeColumnOperand<uint8_t, T>(columnIndex);
+            case DataType::Single:
+                return NativeColumnOperand<float32_t, T>(columnIndex);
+            case DataType::Double:
+                return NativeColumnOperand<float64_t, T>(columnIndex);
+            case DataType::Int8:
+                return NativeColumnOperand<int8_t, T>(columnIndex);
+            case DataType::Int16:
+                return NativeColumnOperand<int16_t, T>(columnIndex);
+            case DataType::Int32:
+                return NativeColumnOperand<int32_t, T>(columnIndex);
+            case DataType::Int64:
+                return NativeColumnOperand<int64_t, T>(columnIndex);
+            case DataType::UInt8:
+                return NativeColumnOperand<uint8_t, T>(columnIndex);
+            case DataType::UInt16:
+                return NativeColumnOperand<uint16_t, T>(columnIndex);
+            case DataType::UInt32:
+                return NativeColumnOperand<uint32_t, T>(columnIndex);
+            default:
+                return nullptr;
+        }
+    }
+
+    template<>
+    CompiledOperand<StringView> ColumnOperand<StringView>(const int32_t columnIndex, const DataType dataType)
+    {
+        if (dataType != DataType::String)
+            return nullptr;
+
+        return [columnIndex](const DataRow& row, StringView& value)
+        {
+            const char* nativeValue = static_cast<const char*>(row.RawValue(columnIndex));
+
+            if (nativeValue == nullptr)
+                return false;
+
+            value = StringView(nativeValue);
+            return true;
+        };
+    }
+
+    template<>
+    CompiledOperand<Guid> ColumnOperand<Guid>(const int32_t columnIndex, const DataType dataType)
+    {
+        if (dataType != DataType::Guid)
+            return nullptr;
+
+        return NativeColumnOperand<Guid, Guid>(columnIndex);
+    }
+
+    template<>
+    CompiledOperand<DateTime> ColumnOperand<DateTime>(const int32_t columnIndex, const DataType dataType)
+    {
+        if (dataType != DataType::DateTime)
+            return nullptr;
+
+        return NativeColumnOperand<DateTime, DateTime>(columnIndex);
+    }
+
+    // Only conversions that cannot fail or lose precision are compiled for column values
+    bool IsWideningConversion(const ExpressionValueType sourceValueType, const ExpressionValueType targetValueType)
+    {
+        if (sourceValueType == targetValueType)
+            return true;
+
+        switch (sourceValueType)
+        {
+            case ExpressionValueType::Boolean:
+                return targetValueType == ExpressionValueType::Int32 || targetValueType == ExpressionValueType::Int64 || targetValueType == ExpressionValueType::Double;
+            case ExpressionValueType::Int32:
+                return targetValueType == ExpressionValueType::Int64 || targetValueType == ExpressionValueType::Double;
+            case ExpressionValueType::Int64:
+                return targetValueType == ExpressionValueType::Double;
+            default:
+                return false;
+        }
+    }
+
+    template<class T, class TComparer>
+    CompiledPredicate ComparisonPredicate(const CompiledOperand<T>& leftOperand, const CompiledOperand<T>& rightOperand, TComparer comparer)
+    {
+        return [leftOperand, rightOperand, comparer](const DataRow& row) -> Nullable<bool>
+        {
+            T leftValue, rightValue;
+
+            // If left or right value is Null, result is Null
+            if (!leftOperand(row, leftValue) || !rightOperand(row, rightValue))
+                return nullptr;
+
+            return comparer(leftValue, rightValue);
+        };
+    }
+}
+
+bool ExpressionTree::TryGetCompiledValueType(const ExpressionPtr& expression, ExpressionValueType& valueType) const
+{
+    if (expression == nullptr)
+        return false;
+
+    if (expression->Type == ExpressionType::Value)
+    {
+        valueType = CastSharedPtr<ValueExpression>(expression)->ValueType;
+
+        // Undefined NULL values evaluate as a Nullable boolean
+        if (valueType == ExpressionValueType::Undefined)
+            valueType = ExpressionValueType::Boolean;
+
+        return valueType != ExpressionValueType::Decimal;
+    }
+
+    if (expression->Type != ExpressionType::Column)
+        return false;
+
+    const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(expression)->DataColumn;
+
+    if (column == nullptr || column->Computed())
+        return false;
+
+    // Decimal values are not compiled, and UInt64 values change type based on magnitude
+    switch (column->Type())
+    {
+        case DataType::String:
+            valueType = ExpressionValueType::String;
+            return true;
+        case DataType::Boolean:
+            valueType = ExpressionValueType::Boolean;
+            return true;
+        case DataType::DateTime:
+            valueType = ExpressionValueType::DateTime;
+            return true;
+        case DataType::Single:
+        case DataType::Double:
+            valueType = ExpressionValueType::Double;
+            return true;
+        case DataType::Guid:
+            valueType = ExpressionValueType::Guid;
+            return true;
+        case DataType::Int8:
+        case DataType::Int16:
+        case DataType::Int32:
+        case DataType::UInt8:
+        case DataType::UInt16:
+            valueType = ExpressionValueType::Int32;
+            return true;
+        case DataType::Int64:
+        case DataType::UInt32:
+            valueType = ExpressionValueType::Int64;
+            return true;
+        default:
+            return false;
+    }
+}
+
+template<class T>
+CompiledOperand<T> ExpressionTree::CompileOperand(const ExpressionPtr& expression, const ExpressionValueType valueType) const
+{
+    ExpressionValueType sourceValueType;
+
+    if (!TryGetCompiledValueType(expression, sourceValueType))
+        return nullptr;
+
+    if (expression->Type == ExpressionType::Value)
+    {
+        const ValueExpressionPtr valueExpression = CastSharedPtr<ValueExpression>(expression);
+
+        // Null constants always read as Null
+        if (IsNullConstant(valueExpression))
+            return [](const DataRow&, T&) { return false; };
+
+        // Constants are converted to the operation value type once
+        const typename CompiledValue<T>::StorageType constant = ConstantValue<T>(Convert(valueExpression, valueType));
+
+        return [constant](const DataRow&, T& value)
+        {
+            value = constant;
+            return true;
+        };
+    }
+
+    if (!IsWideningConversion(sourceValueType, valueType))
+        return nullptr;
+
+    const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(expression)->DataColumn;
+    return ColumnOperand<T>(column->Index(), column->Type());
+}
+
+template<class T>
+CompiledPredicate ExpressionTree::CompileComparison(const ExpressionOperatorType operatorType, const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression, const ExpressionValueType valueType) const
+{
+    const CompiledOperand<T> leftOperand = CompileOperand<T>(leftExpression, valueType);
+    const CompiledOperand<T> rightOperand = CompileOperand<T>(rightExpression, valueType);
+
+    if (leftOperand == nullptr || rightOperand == nullptr)
+        return nullptr;
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const T& left, const T& right) { return left < right; });
+        case ExpressionOperatorType::LessThanOrEqual:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const T& left, const T& right) { return left <= right; });
+        case ExpressionOperatorType::GreaterThan:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const T& left, const T& right) { return left > right; });
+        case ExpressionOperatorType::GreaterThanOrEqual:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const T& left, const T& right) { return left >= right; });
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const T& left, const T& right) { return left == right; });
+        case ExpressionOperatorType::NotEqual:
+        case ExpressionOperatorType::NotEqualExactMatch:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const T& left, const T& right) { return left != right; });
+        default:
+            return nullptr;
+    }
+}
+
+// String comparisons ignore case, except for exact match equality operators
+template<>
+CompiledPredicate ExpressionTree::CompileComparison<StringView>(const ExpressionOperatorType operatorType, const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression, const ExpressionValueType valueType) const
+{
+    const CompiledOperand<StringView> leftOperand = CompileOperand<StringView>(leftExpression, valueType);
+    const CompiledOperand<StringView> rightOperand = CompileOperand<StringView>(rightExpression, valueType);
+
+    if (leftOperand == nullptr || rightOperand == nullptr)
+        return nullptr;
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return boost::ilexicographical_compare(left, right); });
+        case ExpressionOperatorType::LessThanOrEqual:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return !boost::ilexicographical_compare(right, left); });
+        case ExpressionOperatorType::GreaterThan:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return boost::ilexicographical_compare(right, left); });
+        case ExpressionOperatorType::GreaterThanOrEqual:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return !boost::ilexicographical_compare(left, right); });
+        case ExpressionOperatorType::Equal:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return boost::iequals(left, right); });
+        case ExpressionOperatorType::EqualExactMatch:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return left == right; });
+        case ExpressionOperatorType::NotEqual:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return !boost::iequals(left, right); });
+        case ExpressionOperatorType::NotEqualExactMatch:
+            return ComparisonPredicate(leftOperand, rightOperand, [](const StringView& left, const StringView& right) { return left != right; });
+        default:
+            return nullptr;
+    }
+}
+
+CompiledPredicate ExpressionTree::CompileComparison(const ExpressionOperatorType operatorType, const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression) const
+{
+    ExpressionValueType leftValueType, rightValueType;
+
+    if (!TryGetCompiledValueType(leftExpression, leftValueType) || !TryGetCompiledValueType(rightExpression, rightValueType))
+        return nullptr;
+
+    const ExpressionValueType valueType = DeriveComparisonOperationValueType(operatorType, leftValueType, rightValueType);
+
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+            return CompileComparison<bool>(operatorType, leftExpression, rightExpression, valueType);
+        case ExpressionValueType::Int32:
+            return CompileComparison<int32_t>(operatorType, leftExpression, rightExpression, valueType);
+        case ExpressionValueType::Int64:
+            return CompileComparison<int64_t>(operatorType, leftExpression, rightExpression, valueType);
+        case ExpressionValueType::Double:
+            return CompileComparison<float64_t>(operatorType, leftExpression, rightExpression, valueType);
+        case ExpressionValueType::String:
+            return CompileComparison<StringView>(operatorType, leftExpression, rightExpression, valueType);
+        case ExpressionValueType::Guid:
+            return CompileComparison<Guid>(operatorType, leftExpression, rightExpression, valueType);
+        case ExpressionValueType::DateTime:
+            return CompileComparison<DateTime>(operatorType, leftExpression, rightExpression, valueType);
+        default:
+            return nullptr;
+    }
+}
+
+CompiledPredicate ExpressionTree::CompileIsNull(const ExpressionPtr& expression, const bool isNull) const
+{
+    if (expression == nullptr)
+        return nullptr;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+        {
+            const bool result = IsNullConstant(CastSharedPtr<ValueExpression>(expression)) == isNull;
+            return [result](const DataRow&) -> Nullable<bool> { return result; };
+        }
+        case ExpressionType::Column:
+        {
+            const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(expression)->DataColumn;
+
+            if (column == nullptr || column->Computed())
+                return nullptr;
+
+            const int32_t columnIndex = column->Index();
+            return [columnIndex, isNull](const DataRow& row) -> Nullable<bool> { return (row.RawValue(columnIndex) == nullptr) == isNull; };
+        }
+        default:
+        {
+            const CompiledPredicate predicate = CompilePredicate(expression);
+
+            if (predicate == nullptr)
+                return nullptr;
+
+            return [predicate, isNull](const DataRow& row) -> Nullable<bool> { return !predicate(row).HasValue() == isNull; };
+        }
+    }
+}
+
+CompiledPredicate ExpressionTree::CompileLike(const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression, const bool exactMatch, const bool notLike) const
+{
+    ExpressionValueType leftValueType;
+
+    if (!TryGetCompiledValueType(leftExpression, leftValueType) || leftValueType != ExpressionValueType::String)
+        return nullptr;
+
+    // Pattern must be a string constant so that it can be parsed once
+    if (rightExpression == nullptr || rightExpression->Type != ExpressionType::Value)
+        return nullptr;
+
+    const ValueExpressionPtr rightValue = CastSharedPtr<ValueExpression>(rightExpression);
+
+    if (rightValue->ValueType != ExpressionValueType::String || rightValue->IsNull())
+        return nullptr;
+
+    const CompiledOperand<StringView> leftOperand = CompileOperand<StringView>(leftExpression, ExpressionValueType::String);
+    const LikePattern pattern(rightValue->ValueAsString());
+    const bool ignoreCase = !exactMatch;
+
+    // Invalid patterns report their error when evaluated by walking the tree
+    if (leftOperand == nullptr || !pattern.IsValid)
+        return nullptr;
+
+    return [leftOperand, pattern, ignoreCase, notLike](const DataRow& row) -> Nullable<bool>
+    {
+        StringView leftValue;
+
+        // If left value is Null, result is Null
+        if (!leftOperand(row, leftValue))
+            return nullptr;
+
+        return pattern.IsMatch(leftValue, ignoreCase) != notLike;
+    };
+}
+
+CompiledPredicate ExpressionTree::CompileRegExMatch(const ExpressionPtr& expression) const
+{
+    const ExpressionCollectionPtr& arguments = CastSharedPtr<FunctionExpression>(expression)->Arguments;
+
+    if (arguments->size() != 2)
+        return nullptr;
+
+    const ExpressionPtr& regexExpression = arguments->at(0);
+    const ExpressionPtr& testExpression = arguments->at(1);
+    ExpressionValueType testValueType;
+
+    // Expression must be a string constant so that it can be constructed once
+    if (regexExpression == nullptr || regexExpression->Type != ExpressionType::Value)
+        return nullptr;
+
+    const ValueExpressionPtr regexValue = CastSharedPtr<ValueExpression>(regexExpression);
+
+    if (regexValue->ValueType != ExpressionValueType::String || regexValue->IsNull())
+        return nullptr;
+
+    if (!TryGetCompiledValueType(testExpression, testValueType) || testValueType != ExpressionValueType::String)
+        return nullptr;
+
+    const CompiledOperand<StringView> testOperand = CompileOperand<StringView>(testExpression, ExpressionValueType::String);
+
+    if (testOperand == nullptr)
+        return nullptr;
+
+    const SharedPtr<regex> pattern = GetRegex(regexValue->ValueAsString());
+
+    return [testOperand, pattern](const DataRow& row) -> Nullable<bool>
+    {
+        StringView testValue;
+
+        if (!testOperand(row, testValue))
+            return nullptr;
+
+        return regex_search(testValue.begin(), testValue.end(), *pattern);
+    };
+}
+
+CompiledPredicate ExpressionTree::CompileInList(const ExpressionPtr& expression) const
+{
+    const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+    const ExpressionOperatorType operatorType = inListExpression->ExactMatch ? ExpressionOperatorType::EqualExactMatch : ExpressionOperatorType::Equal;
+    const bool hasNotKeyword = inListExpression->HasNotKeyword;
+    const CompiledPredicate valueIsNull = CompileIsNull(inListExpression->Value, true);
+
+    if (valueIsNull == nullptr)
+        return nullptr;
+
+    vector<CompiledPredicate> comparisons;
+    comparisons.reserve(inListExpression->Arguments->size());
+
+    for (const ExpressionPtr& argument : *inListExpression->Arguments)
+    {
+        const CompiledPredicate comparison = CompileComparison(operatorType, inListExpression->Value, argument);
+
+        if (comparison == nullptr)
+            return nullptr;
+
+        comparisons.push_back(comparison);
+    }
+
+    return [valueIsNull, comparisons, hasNotKeyword](const DataRow& row) -> Nullable<bool>
+    {
+        // If in list test value is Null, result is Null
+        if (valueIsNull(row).GetValueOrDefault())
+            return nullptr;
+
+        for (const CompiledPredicate& comparison : comparisons)
+        {
+            if (comparison(row).GetValueOrDefault())
+                return !hasNotKeyword;
+        }
+
+        return hasNotKeyword;
+    };
+}
+
+CompiledPredicate ExpressionTree::CompilePredicate(const ExpressionPtr& expression) const
+{
+    if (expression == nullptr)
+        return nullptr;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+        {
+            const ValueExpressionPtr valueExpression = CastSharedPtr<ValueExpression>(expression);
+
+            // Undefined NULL values evaluate as a Nullable boolean
+            if (valueExpression->ValueType == ExpressionValueType::Undefined)
+                return [](const DataRow&) -> Nullable<bool> { return nullptr; };
+
+            if (valueExpression->ValueType != ExpressionValueType::Boolean)
+                return nullptr;
+
+            // Captured as plain values, Nullable is only assignable
+            const Nullable<bool> result = valueExpression->ValueAsNullableBoolean();
+            const bool hasValue = result.HasValue();
+            const bool value = result.GetValueOrDefault();
+
+            return [hasValue, value](const DataRow&) { return hasValue ? Nullable<bool>(value) : Nullable<bool>(nullptr); };
+        }
+        case ExpressionType::Column:
+        {
+            const CompiledOperand<bool> operand = CompileOperand<bool>(expression, ExpressionValueType::Boolean);
+
+            if (operand == nullptr)
+                return nullptr;
+
+            return [operand](const DataRow& row) -> Nullable<bool>
+            {
+                bool value;
+
+                if (operand(row, value))
+                    return value;
+
+                return nullptr;
+            };
+        }
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+
+            if (unaryExpression->UnaryType != ExpressionUnaryType::Not)
+                return nullptr;
+
+            const CompiledPredicate predicate = CompilePredicate(unaryExpression->Value);
+
+            if (predicate == nullptr)
+                return nullptr;
+
+            return [predicate](const DataRow& row) -> Nullable<bool>
+            {
+                const Nullable<bool> value = predicate(row);
+
+                // If unary value is Null, result is Null
+                if (!value.HasValue())
+                    return nullptr;
+
+                return !value.GetValueOrDefault();
+            };
+        }
+        case ExpressionType::InList:
+            return CompileInList(expression);
+        case ExpressionType::Function:
+        {
+            if (CastSharedPtr<FunctionExpression>(expression)->FunctionType == ExpressionFunctionType::RegExMatch)
+                return CompileRegExMatch(expression);
+
+            return nullptr;
+        }
+        case ExpressionType::Operator:
+            break;
+        default:
+            return nullptr;
+    }
+
+    const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+    const ExpressionOperatorType operatorType = operatorExpression->OperatorType;
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::LessThan:
+        case ExpressionOperatorType::LessThanOrEqual:
+        case ExpressionOperatorType::GreaterThan:
+        case ExpressionOperatorType::GreaterThanOrEqual:
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+        case ExpressionOperatorType::NotEqual:
+        case ExpressionOperatorType::NotEqualExactMatch:
+            return CompileComparison(operatorType, operatorExpression->LeftValue, operatorExpression->RightValue);
+        case ExpressionOperatorType::IsNull:
+            return CompileIsNull(operatorExpression->LeftValue, true);
+        case ExpressionOperatorType::IsNotNull:
+            return CompileIsNull(operatorExpression->LeftValue, false);
+        case ExpressionOperatorType::Like:
+            return CompileLike(operatorExpression->LeftValue, operatorExpression->RightValue, false, false);
+        case ExpressionOperatorType::LikeExactMatch:
+            return CompileLike(operatorExpression->LeftValue, operatorExpression->RightValue, true, false);
+        case ExpressionOperatorType::NotLike:
+            return CompileLike(operatorExpression->LeftValue, operatorExpression->RightValue, false, true);
+        case ExpressionOperatorType::NotLikeExactMatch:
+            return CompileLike(operatorExpression->LeftValue, operatorExpression->RightValue, true, true);
+        case ExpressionOperatorType::And:
+        case ExpressionOperatorType::Or:
+            break;
+        default:
+            return nullptr;
+    }
+
+    const CompiledPredicate leftPredicate = CompilePredicate(operatorExpression->LeftValue);
+    const CompiledPredicate rightPredicate = CompilePredicate(operatorExpression->RightValue);
+
+    if (leftPredicate == nullptr || rightPredicate == nullptr)
+        return nullptr;
+
+    const bool isAnd = operatorType == ExpressionOperatorType::And;
+
+    return [leftPredicate, rightPredicate, isAnd](const DataRow& row) -> Nullable<bool>
+    {
+        const Nullable<bool> leftValue = leftPredicate(row);
+        const Nullable<bool> rightValue = rightPredicate(row);
+
+        // If left or right value is Null, result is Null
+        if (!leftValue.HasValue() || !rightValue.HasValue())
+            return nullptr;
+
+        if (isAnd)
+            return leftValue.GetValueOrDefault() && rightValue.GetValueOrDefault();
+
+        return leftValue.GetValueOrDefault() || rightValue.GetValueOrDefault();
+    };
+}
+
 ExpressionTree::ExpressionTree(DataTablePtr table) :
     m_table(std::move(table)),
     TopLimit(-1)
@@ -3210,6 +3911,33 @@ ValueExpressionPtr ExpressionTree::Evaluate(const DataRowPtr& row)
     return Evaluate(Root);
 }
 
+bool ExpressionTree::Compile()
+{
+    // Tree is compiled once, unless root expression is replaced
+    if (m_compiledRoot != Root)
+    {
+        m_compiledRoot = Root;
+
+        try
+        {
+            m_compiledPredicate = CompilePredicate(Root);
+        }
+        catch (...)
+        {
+            // Expressions that fail to compile, e.g., on an invalid constant
+            // conversion, report their errors when evaluated by walking the tree
+            m_compiledPredicate = nullptr;
+        }
+    }
+
+    return m_compiledPredicate != nullptr;
+}
+
+Nullable<bool> ExpressionTree::EvaluatePredicate(const DataRowPtr& row) const
+{
+    return m_compiledPredicate(*row);
+}
+
 const ValueExpressionPtr ExpressionTree::True = NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, true);
 
 const ValueExpressionPtr ExpressionTree::False = NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, false);
@@ -26,6 +26,7 @@
 
 #include "../../Common/CommonTypes.h"
 #include "../../Data/DataSet.h"
+#include <regex>
 
 namespace GSF {
 namespace FilterExpressions
@@ -278,11 +279,43 @@ namespace FilterExpressions
 
     typedef GSF::SharedPtr<OperatorExpression> OperatorExpressionPtr;
 
+    // LIKE expression pattern parsed for matching without regular expressions. Supported patterns
+    // only have wild cards, i.e., "*" or "%", at the start and/or end of the test expression.
+    struct LikePattern
+    {
+        std::string TestExpression;
+        bool StartsWithWildcard;
+        bool EndsWithWildcard;
+        bool IsValid;
+
+        LikePattern(const std::string& pattern);
+
+        // Determines if value matches a valid pattern
+        bool IsMatch(const GSF::StringView& value, bool ignoreCase) const;
+    };
+
+    // Filter expression compiled to a typed predicate, evaluates a row without allocating
+    typedef std::function<GSF::Nullable<bool>(const GSF::Data::DataRow&)> CompiledPredicate;
+
+    // Column or constant operand of a compiled predicate, reads a typed value
+    // from a row and returns false when the value is Null
+    template<class T>
+    using CompiledOperand = std::function<bool(const GSF::Data::DataRow&, T&)>;
+
     class ExpressionTree
     {
     private:
         GSF::Data::DataRowPtr m_currentRow;
         GSF::Data::DataTablePtr m_table;
+        ExpressionPtr m_compiledRoot;
+        CompiledPredicate m_compiledPredicate;
+
+        // Patterns parsed during evaluation, keyed by pattern text
+        mutable std::unordered_map<std::string, LikePattern> m_likePatterns;
+        mutable std::unordered_map<std::string, GSF::SharedPtr<std::regex>> m_regexPatterns;
+
+        const LikePattern& GetLikePattern(const std::string& pattern) const;
+        const GSF::SharedPtr<std::regex>& GetRegex(const std::string& expressionText) const;
 
         ValueExpressionPtr Evaluate(const ExpressionPtr& expression, ExpressionValueType targetValueType = ExpressionValueType::Boolean) const;
         ValueExpressionPtr EvaluateUnary(const ExpressionPtr& expression) const;
@@ -375,6 +408,21 @@ namespace FilterExpressions
 
         ValueExpressionPtr Convert(const ValueExpressionPtr& sourceValue, ExpressionValueType targetValueType) const;
         ValueExpressionPtr EvaluateRegEx(const std::string& functionName, const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, bool returnMatchedValue) const;
+
+        // Filter Expression Compilation
+        CompiledPredicate CompilePredicate(const ExpressionPtr& expression) const;
+        CompiledPredicate CompileComparison(ExpressionOperatorType operatorType, const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression) const;
+        CompiledPredicate CompileIsNull(const ExpressionPtr& expression, bool isNull) const;
+        CompiledPredicate CompileLike(const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression, bool exactMatch, bool notLike) const;
+        CompiledPredicate CompileInList(const ExpressionPtr& expression) const;
+        CompiledPredicate CompileRegExMatch(const ExpressionPtr& expression) const;
+        bool TryGetCompiledValueType(const ExpressionPtr& expression, ExpressionValueType& valueType) const;
+
+        template<class T>
+        CompiledPredicate CompileComparison(ExpressionOperatorType operatorType, const ExpressionPtr& leftExpression, const ExpressionPtr& rightExpression, ExpressionValueType valueType) const;
+
+        template<class T>
+        CompiledOperand<T> CompileOperand(const ExpressionPtr& expression, ExpressionValueType valueType) const;
     public:
         ExpressionTree(GSF::Data::DataTablePtr table);
 
@@ -386,6 +434,15 @@ namespace FilterExpressions
 
         ValueExpressionPtr Evaluate(const GSF::Data::DataRowPtr& row);
 
+        // Compiles the expression tree into a typed predicate, resolving column indexes and value
+        // types once so that rows can be evaluated without allocating a value per expression node.
+        // Returns false when the tree uses expressions the compiler does not handle, e.g., functions
+        // or arithmetic, in which case rows must be evaluated by walking the tree.
+        bool Compile();
+
+        // Evaluates the compiled predicate for the given row, Compile must have succeeded.
+        GSF::Nullable<bool> EvaluatePredicate(const GSF::Data::DataRowPtr& row) const;
+
         static const ValueExpressionPtr True;
         static const ValueExpressionPtr False;
         static const ValueExpressionPtr EmptyString;
@@ -24,6 +24,7 @@
 #include "FilterExpressionParser.h"
 #include "tree/ParseTreeWalker.h"
 #include "../Common/Nullable.h"
+#include <list>
 
 using namespace std;
 using namespace GSF;
@@ -95,30 +96,100 @@ const char* FilterExpressionParserException::what() const noexcept
     return m_message.c_str();
 }
 
+struct FilterExpressionParser::ParsedSyntax
+{
+    const string FilterExpression;
+    ANTLRInputStream InputStream;
+    FilterExpressionSyntaxLexer Lexer;
+    CommonTokenStream Tokens;
+    FilterExpressionSyntaxParser Parser;
+
+    // Parse tree nodes are owned by the parser, tree is null until filter expression has been parsed
+    FilterExpressionSyntaxParser::ParseContext* ParseTree;
+
+    ParsedSyntax(const string& filterExpression) :
+        FilterExpression(filterExpression),
+        InputStream(filterExpression),
+        Lexer(&InputStream),
+        Tokens(&Lexer),
+        Parser(&Tokens),
+        ParseTree(nullptr)
+    {
+    }
+};
+
+// Parse trees hold no references to any dataset, so cached filter expressions, e.g., subscriber filters
+// that are re-evaluated on each reconnect or metadata refresh, remain valid when metadata is redefined
+struct FilterExpressionParser::ParsedSyntaxCache
+{
+    static const size_t MaxCachedExpressions = 128;
+
+    Mutex Lock;
+    list<ParsedSyntaxPtr> Entries;
+    unordered_map<string, list<ParsedSyntaxPtr>::iterator> Lookup;
+
+    ParsedSyntaxPtr TryGet(const string& filterExpression)
+    {
+        ScopeLock lock(Lock);
+        const auto iterator = Lookup.find(filterExpression);
+
+        if (iterator == Lookup.end())
+            return nullptr;
+
+        // Move entry to front of list as most recently used
+        Entries.splice(Entries.begin(), Entries, iterator->second);
+        return *iterator->second;
+    }
+
+    void Add(const ParsedSyntaxPtr& syntax)
+    {
+        ScopeLock lock(Lock);
+
+        if (Lookup.find(syntax->FilterExpression) != Lookup.end())
+            return;
+
+        Entries.push_front(syntax);
+        Lookup.emplace(syntax->FilterExpression, Entries.begin());
+
+        // Evict least recently used entry
+        if (Entries.size() > MaxCachedExpressions)
+        {
+            Lookup.erase(Entries.back()->FilterExpression);
+            Entries.pop_back();
+        }
+    }
+};
+
 FilterExpressionParser::FilterExpressionParser(const string& filterExpression, const bool suppressConsoleErrorOutput) :
-    m_inputStream(filterExpression),
+    m_syntax(GetParsedSyntaxCache().TryGet(filterExpression)),
     m_callbackErrorListener(nullptr),
     m_dataSet(nullptr),
     m_trackFilteredRows(true),
     m_trackFilteredSignalIDs(false),
     m_filterExpressionStatementCount(0)
 {
-    m_lexer = new FilterExpressionSyntaxLexer(&m_inputStream);
-    m_tokens = new CommonTokenStream(m_lexer);
-    m_parser = new FilterExpressionSyntaxParser(m_tokens);
-    
+    // Previously parsed filter expressions are shared, otherwise filter expression is parsed on first visit
+    if (m_syntax != nullptr)
+        return;
+
+    m_syntax = NewSharedPtr<ParsedSyntax>(filterExpression);
+
     if (suppressConsoleErrorOutput)
-        m_parser->removeErrorListeners();
+        m_syntax->Parser.removeErrorListeners();
 }
 
 FilterExpressionParser::~FilterExpressionParser()
 {
-    delete m_lexer;
-    delete m_tokens;
-    delete m_parser;
     delete m_callbackErrorListener;
 }
 
+FilterExpressionParser::ParsedSyntaxCache& FilterExpressionParser::GetParsedSyntaxCache()
+{
+    // Function level static so cache is available during static initialization
+    static ParsedSyntaxCache parsedSyntaxCache;
+    return parsedSyntaxCache;
+}
+
 FilterExpressionParser::CallbackErrorListener::CallbackErrorListener(FilterExpressionParserPtr filterExpressionParser, ParsingExceptionCallback parsingExceptionCallback) :
     m_filterExpressionParser(std::move(filterExpressionParser)),
     m_parsingExceptionCallback(std::move(parsingExceptionCallback))
@@ -132,10 +203,23 @@ void FilterExpressionParser::CallbackErrorListener::syntaxError(Recognizer* reco
 
 void FilterExpressionParser::VisitParseTreeNodes()
 {
-    // Create parse tree and visit listener methods
+    // Create parse tree once, later visits walk the existing tree
+    if (m_syntax->ParseTree == nullptr)
+    {
+        m_syntax->ParseTree = m_syntax->Parser.parse();
+
+        // Parsing exceptions are only reported while parsing, so listener is no longer needed
+        if (m_callbackErrorListener)
+            m_syntax->Parser.removeErrorListener(m_callbackErrorListener);
+
+        // Only filter expressions without syntax errors are shared with other parsers
+        if (m_syntax->Lexer.getNumberOfSyntaxErrors() == 0 && m_syntax->Parser.getNumberOfSyntaxErrors() == 0)
+            GetParsedSyntaxCache().Add(m_syntax);
+    }
+
+    // Visit listener methods
     ParseTreeWalker walker;
-    const auto parseTree = m_parser->parse();
-    walker.walk(this, parseTree);
+    walker.walk(this, m_syntax->ParseTree);
 }
 
 void FilterExpressionParser::InitializeSetOperations()
@@ -213,6 +297,20 @@ void FilterExpressionParser::MapMatchedFieldRow(const DataTablePtr& primaryTable
 
     const int32_t columnIndex = column->Index();
 
+    // Index identifier columns on first use so that each following lookup is not a table scan
+    if (column->Type() == DataType::String && !column->Computed())
+    {
+        vector<int32_t> rowIndexes;
+
+        if (!primaryTable->HasIndex(columnIndex))
+            primaryTable->CreateIndex(columnIndex);
+
+        if (primaryTable->TryFindRows(columnIndex, matchValue, rowIndexes) && !rowIndexes.empty())
+            AddMatchedRow(primaryTable->Row(rowIndexes[0]), signalIDColumnIndex);
+
+        return;
+    }
+
     for (int32_t i = 0; i < primaryTable->RowCount(); i++)
     {
         const DataRowPtr& row = primaryTable->Row(i);
@@ -282,15 +380,19 @@ void FilterExpressionParser::RegisterParsingExceptionCallback(const ParsingExcep
 {
     if (m_callbackErrorListener)
     {
-        m_parser->removeErrorListener(m_callbackErrorListener);
+        m_syntax->Parser.removeErrorListener(m_callbackErrorListener);
         delete m_callbackErrorListener;
+        m_callbackErrorListener = nullptr;
     }
 
     if (parsingExceptionCallback == nullptr)
         return;
 
     m_callbackErrorListener = new CallbackErrorListener(shared_from_this(), parsingExceptionCallback);
-    m_parser->addErrorListener(m_callbackErrorListener);
+
+    // A filter expression that has already been parsed, e.g., one shared from the parse cache, has no syntax errors to report
+    if (m_syntax->ParseTree == nullptr)
+        m_syntax->Parser.addErrorListener(m_callbackErrorListener);
 }
 
 void FilterExpressionParser::Evaluate()
@@ -519,7 +621,32 @@ void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParse
 
     if (m_trackFilteredRows && signalID != Empty::Guid)
     {
-        // Map matching row for manually specified Guid
+        // Map matching row for manually specified Guid, indexing signal ID column on first use
+        if (signalIDColumn->Type() == DataType::Guid && !signalIDColumn->Computed())
+        {
+            vector<int32_t> rowIndexes;
+
+            if (!primaryTable->HasIndex(signalIDColumnIndex))
+                primaryTable->CreateIndex(signalIDColumnIndex);
+
+            if (primaryTable->TryFindRows(signalIDColumnIndex, signalID, rowIndexes) && !rowIndexes.empty())
+            {
+                const DataRowPtr& row = primaryTable->Row(rowIndexes[0]);
+
+                if (m_filterExpressionStatementCount > 1)
+                {
+                    if (m_filteredRowSet.insert(row).second)
+                        m_filteredRows.push_back(row);
+                }
+                else
+                {
+                    m_filteredRows.push_back(row);
+                }
+            }
+
+            return;
+        }
+
         for (int32_t i = 0; i < primaryTable->RowCount(); i++)
         {
             const DataRowPtr& row = primaryTable->Row(i);
@@ -1222,21 +1349,131 @@ vector<DataRowPtr> FilterExpressionParser::Select(const DataTablePtr& dataTable,
     return Select(dataTable->Parent(), filterExpression, dataTable->Name(), tableIDFields, suppressConsoleErrorOutput);
 }
 
+static bool TryFindIndexedRows(const DataTablePtr& table, const ExpressionPtr& columnExpression, const ExpressionPtr& valueExpression, vector<int32_t>& rowIndexes)
+{
+    if (columnExpression == nullptr || columnExpression->Type != ExpressionType::Column || valueExpression == nullptr || valueExpression->Type != ExpressionType::Value)
+        return false;
+
+    const DataColumnPtr& column = CastSharedPtr<ColumnExpression>(columnExpression)->DataColumn;
+    const ValueExpressionPtr value = CastSharedPtr<ValueExpression>(valueExpression);
+
+    if (column == nullptr || column->Parent() != table || value->ValueType == ExpressionValueType::Undefined || value->IsNull())
+        return false;
+
+    // String index lookups ignore case, so they also cover exact match comparisons
+    if (value->ValueType == ExpressionValueType::String)
+        return table->TryFindRows(column->Index(), value->ValueAsString(), rowIndexes);
+
+    if (value->ValueType == ExpressionValueType::Guid)
+        return table->TryFindRows(column->Index(), value->ValueAsGuid(), rowIndexes);
+
+    return false;
+}
+
+// Gets the indexes, in table order, of the rows that can match the expression using column indexes,
+// returns false when the expression cannot be narrowed by an index and all rows need evaluation
+static bool TryGetIndexedRowIndexes(const DataTablePtr& table, const ExpressionPtr& expression, vector<int32_t>& rowIndexes)
+{
+    if (expression == nullptr)
+        return false;
+
+    if (expression->Type == ExpressionType::InList)
+    {
+        const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+
+        if (inListExpression->HasNotKeyword)
+            return false;
+
+        for (const ExpressionPtr& argument : *inListExpression->Arguments)
+        {
+            if (!TryFindIndexedRows(table, inListExpression->Value, argument, rowIndexes))
+                return false;
+        }
+
+        sort(rowIndexes.begin(), rowIndexes.end());
+        rowIndexes.erase(unique(rowIndexes.begin(), rowIndexes.end()), rowIndexes.end());
+        return true;
+    }
+
+    if (expression->Type != ExpressionType::Operator)
+        return false;
+
+    const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+    vector<int32_t> leftRowIndexes, rightRowIndexes;
+
+    switch (operatorExpression->OperatorType)
+    {
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+        {
+            if (!TryFindIndexedRows(table, operatorExpression->LeftValue, operatorExpression->RightValue, rowIndexes) &&
+                !TryFindIndexedRows(table, operatorExpression->RightValue, operatorExpression->LeftValue, rowIndexes))
+                return false;
+
+            return true;
+        }
+        case ExpressionOperatorType::And:
+        {
+            const bool leftIndexed = TryGetIndexedRowIndexes(table, operatorExpression->LeftValue, leftRowIndexes);
+            const bool rightIndexed = TryGetIndexedRowIndexes(table, operatorExpression->RightValue, rightRowIndexes);
+
+            if (leftIndexed && rightIndexed)
+                set_intersection(leftRowIndexes.begin(), leftRowIndexes.end(), rightRowIndexes.begin(), rightRowIndexes.end(), back_inserter(rowIndexes));
+            else if (leftIndexed)
+                rowIndexes.swap(leftRowIndexes);
+            else if (rightIndexed)
+                rowIndexes.swap(rightRowIndexes);
+            else
+                return false;
+
+            return true;
+        }
+        case ExpressionOperatorType::Or:
+        {
+            if (!TryGetIndexedRowIndexes(table, operatorExpression->LeftValue, leftRowIndexes) ||
+                !TryGetIndexedRowIndexes(table, operatorExpression->RightValue, rightRowIndexes))
+                return false;
+
+            set_union(leftRowIndexes.begin(), leftRowIndexes.end(), rightRowIndexes.begin(), rightRowIndexes.end(), back_inserter(rowIndexes));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 vector<DataRowPtr> FilterExpressionParser::Select(const ExpressionTreePtr& expressionTree)
 {
     const DataTablePtr& table = expressionTree->Table();
     vector<DataRowPtr> matchedRows;
 
-    for (int32_t i = 0; i < table->RowCount(); i++)
+    // Compiled expression trees evaluate rows without allocating, other trees are evaluated node by node
+    const bool compiled = expressionTree->Compile();
+
+    // Column indexes narrow equality and IN list filters down to the candidate rows to evaluate
+    vector<int32_t> rowIndexes;
+    const bool indexed = TryGetIndexedRowIndexes(table, expressionTree->Root, rowIndexes);
+    const int32_t rowCount = indexed ? static_cast<int32_t>(rowIndexes.size()) : table->RowCount();
+
+    for (int32_t i = 0; i < rowCount; i++)
     {
         if (expressionTree->TopLimit > -1 && static_cast<int32_t>(matchedRows.size()) >= expressionTree->TopLimit)
             break;
 
-        const DataRowPtr& row = table->Row(i);
+        const DataRowPtr& row = table->Row(indexed ? rowIndexes[i] : i);
 
         if (row == nullptr)
             continue;
 
+        if (compiled)
+        {
+            // If compiled result is Null, treat result as False
+            if (expressionTree->EvaluatePredicate(row).GetValueOrDefault())
+                matchedRows.push_back(row);
+
+            continue;
+        }
+
         const ValueExpressionPtr& resultExpression = expressionTree->Evaluate(row);
 
         // Final expression should have a boolean data type (it's part of a WHERE clause)
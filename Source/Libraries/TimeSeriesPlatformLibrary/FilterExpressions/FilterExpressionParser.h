@@ -80,10 +80,14 @@ namespace FilterExpressions
             void syntaxError(antlr4::Recognizer* recognizer, antlr4::Token* offendingSymbol, size_t line, size_t charPositionInLine, const std::string& msg, std::exception_ptr e) override;
         };
 
-        antlr4::ANTLRInputStream m_inputStream;
-        FilterExpressionSyntaxLexer* m_lexer;
-        antlr4::CommonTokenStream* m_tokens;
-        FilterExpressionSyntaxParser* m_parser;
+        // Lexed and parsed filter expression, shared by parsers of the same filter expression text
+        struct ParsedSyntax;
+        typedef GSF::SharedPtr<ParsedSyntax> ParsedSyntaxPtr;
+
+        // Least recently used cache of parsed filter expressions
+        struct ParsedSyntaxCache;
+
+        ParsedSyntaxPtr m_syntax;
         CallbackErrorListener* m_callbackErrorListener;
         GSF::Data::DataSetPtr m_dataSet;
         std::string m_primaryTableName;
@@ -109,6 +113,8 @@ namespace FilterExpressions
         inline void MapMatchedFieldRow(const GSF::Data::DataTablePtr& primaryTable, const std::string& columnName, const std::string& matchValue, int32_t signalIDColumnIndex);
         inline bool TryGetExpr(const antlr4::ParserRuleContext* context, ExpressionPtr& expression) const;
         inline void AddExpr(const antlr4::ParserRuleContext* context, const ExpressionPtr& expression);
+
+        static ParsedSyntaxCache& GetParsedSyntaxCache();
     public:
         FilterExpressionParser(const std::string& filterExpression, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
         ~FilterExpressionParser();
@@ -0,0 +1,229 @@
+//******************************************************************************************************
+//  AesCipherTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstring>
+
+#include "../Common/AesCipher.h"
+
+using namespace std;
+using namespace GSF;
+
+vector<uint8_t> FromHex(const string& hex)
+{
+    vector<uint8_t> bytes;
+
+    for (size_t i = 0; i + 1 < hex.size(); i += 2)
+        bytes.push_back(static_cast<uint8_t>(stoul(hex.substr(i, 2), nullptr, 16)));
+
+    return bytes;
+}
+
+// Determines whether the action throws the given exception type.
+template<typename TException, typename TAction>
+bool Throws(TAction action)
+{
+    try
+    {
+        action();
+    }
+    catch (const TException&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+// Tests the AES cipher against published test vectors and round trips messages of all padding lengths.
+int main(int argc, char* argv[])
+{
+    int32_t test = 0;
+
+    // Test 1
+    {
+        // FIPS-197 appendix C examples for AES-128, AES-192 and AES-256, a single block
+        // with a zero IV in CBC mode is the same as the block cipher itself
+        const vector<string> keys =
+        {
+            "000102030405060708090a0b0c0d0e0f",
+            "000102030405060708090a0b0c0d0e0f1011121314151617",
+            "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+        };
+
+        const vector<string> cipherTexts =
+        {
+            "69c4e0d86a7b0430d8cdb78070b4c55a",
+            "dda97ca4864cdfe06eaf70a0ec0d7191",
+            "8ea2b7ca516745bfeafc49904b496089"
+        };
+
+        const vector<uint8_t> plainText = FromHex("00112233445566778899aabbccddeeff");
+        const uint8_t iv[AesCipher::BlockSize] = {};
+
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            const vector<uint8_t> key = FromHex(keys[i]);
+            const vector<uint8_t> cipherText = FromHex(cipherTexts[i]);
+            const AesCipher cipher(key.data(), static_cast<uint32_t>(key.size()));
+            vector<uint8_t> buffer(plainText);
+
+            buffer.resize(AesCipher::GetEncryptedLength(static_cast<uint32_t>(plainText.size())));
+
+            const uint32_t encryptedLength = cipher.Encrypt(buffer.data(), static_cast<uint32_t>(plainText.size()), iv);
+            assert(encryptedLength == 32);
+            assert(memcmp(buffer.data(), cipherText.data(), cipherText.size()) == 0);
+
+            const uint32_t decryptedLength = cipher.Decrypt(buffer.data(), encryptedLength, iv);
+            assert(decryptedLength == plainText.size());
+            assert(memcmp(buffer.data(), plainText.data(), plainText.size()) == 0);
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 2
+    {
+        // NIST SP 800-38A F.2.1 CBC-AES128 example, checks chaining across blocks
+        const vector<uint8_t> key = FromHex("2b7e151628aed2a6abf7158809cf4f3c");
+        const vector<uint8_t> iv = FromHex("000102030405060708090a0b0c0d0e0f");
+
+        const vector<uint8_t> plainText = FromHex(
+            "6bc1bee22e409f96e93d7e117393172a"
+            "ae2d8a571e03ac9c9eb76fac45af8e51"
+            "30c81c46a35ce411e5fbc1191a0a52ef"
+            "f69f2445df4f9b17ad2b417be66c3710");
+
+        const vector<uint8_t> cipherText = FromHex(
+            "7649abac8119b246cee98e9b12e9197d"
+            "5086cb9b507219ee95db113a917678b2"
+            "73bed6b8e3c1743b7116e69e22229516"
+            "3ff1caa1681fac09120eca307586e1a7");
+
+        AesCipher cipher;
+        vector<uint8_t> buffer(plainText);
+
+        assert(!cipher.KeyDefined());
+        cipher.SetKey(key.data(), static_cast<uint32_t>(key.size()));
+        assert(cipher.KeyDefined());
+
+        buffer.resize(AesCipher::GetEncryptedLength(static_cast<uint32_t>(plainText.size())));
+
+        const uint32_t encryptedLength = cipher.Encrypt(buffer.data(), static_cast<uint32_t>(plainText.size()), iv.data());
+        assert(encryptedLength == 80);
+        assert(memcmp(buffer.data(), cipherText.data(), cipherText.size()) == 0);
+
+        const uint32_t decryptedLength = cipher.Decrypt(buffer.data(), encryptedLength, iv.data());
+        assert(decryptedLength == plainText.size());
+        assert(memcmp(buffer.data(), plainText.data(), plainText.size()) == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 3
+    {
+        // Messages of every padding length round trip with each key size
+        mt19937 random(5);
+
+        assert(AesCipher::GetEncryptedLength(0) == 16);
+        assert(AesCipher::GetEncryptedLength(15) == 16);
+        assert(AesCipher::GetEncryptedLength(16) == 32);
+
+        for (uint32_t keyLength = 16; keyLength <= AesCipher::MaxKeySize; keyLength += 8)
+        {
+            uint8_t key[AesCipher::MaxKeySize];
+            uint8_t iv[AesCipher::BlockSize];
+
+            for (uint8_t& value : key)
+                value = static_cast<uint8_t>(random());
+
+            for (uint8_t& value : iv)
+                value = static_cast<uint8_t>(random());
+
+            const AesCipher cipher(key, keyLength);
+
+            for (uint32_t length = 0; length <= 100; length++)
+            {
+                vector<uint8_t> message(length);
+
+                for (uint8_t& value : message)
+                    value = static_cast<uint8_t>(random());
+
+                vector<uint8_t> buffer(message);
+                buffer.resize(AesCipher::GetEncryptedLength(length));
+
+                const uint32_t encryptedLength = cipher.Encrypt(buffer.data(), length, iv);
+                assert(encryptedLength == buffer.size());
+                assert(length == 0 || memcmp(buffer.data(), message.data(), length) != 0);
+
+                const uint32_t decryptedLength = cipher.Decrypt(buffer.data(), encryptedLength, iv);
+                assert(decryptedLength == length);
+                assert(length == 0 || memcmp(buffer.data(), message.data(), length) == 0);
+            }
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 4
+    {
+        // Invalid keys, lengths and padding are rejected
+        const vector<uint8_t> key = FromHex("000102030405060708090a0b0c0d0e0f");
+        const uint8_t iv[AesCipher::BlockSize] = {};
+        const AesCipher cipher(key.data(), static_cast<uint32_t>(key.size()));
+        AesCipher undefinedCipher;
+        uint8_t buffer[32] = {};
+
+        assert(Throws<invalid_argument>([&] { undefinedCipher.SetKey(key.data(), 20); }));
+        assert(Throws<runtime_error>([&] { undefinedCipher.Encrypt(buffer, 16, iv); }));
+        assert(Throws<runtime_error>([&] { cipher.Decrypt(buffer, 15, iv); }));
+
+        // Padding of a full block with the final byte set to zero is never valid
+        buffer[15] = 0;
+        cipher.Encrypt(buffer, 16, iv);
+        assert(Throws<runtime_error>([&] { cipher.Decrypt(buffer, 16, iv); }));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 5
+    {
+        uint8_t first[48] = {};
+        uint8_t second[48] = {};
+
+        AesCipher::GenerateRandomBytes(first, sizeof(first));
+        AesCipher::GenerateRandomBytes(second, sizeof(second));
+
+        assert(memcmp(first, second, sizeof(first)) != 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
@@ -27,6 +27,7 @@
 #include <string>
 #include <fstream>
 #include <iterator>
+#include <atomic>
 #include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -1440,6 +1441,184 @@ int main(int argc, char* argv[])
     assert(time == FromTicks(ticks));
     cout << "Test " << ++test << " succeeded..." << endl;
 
+    // Test 151 - test compiled predicates against evaluation by walking the expression tree
+    const DataTablePtr measurementDetail = dataSet->Table("MeasurementDetail");
+
+    const vector<string> compiledExpressions =
+    {
+        "SignalAcronym = 'STAT'",
+        "SignalAcronym === 'stat'",
+        "SignalAcronym <> 'FREQ' AND PhasorSourceIndex > 1",
+        "PhasorSourceIndex <= 2 OR Internal",
+        "NOT Enabled OR PhasorSourceIndex IS NULL",
+        "Description IS NOT NULL AND Description LIKE '%Status%'",
+        "PointTag NOT LIKE '%-PA%'",
+        "SignalAcronym IN ('FREQ', 'DFDT', 'IPHM')",
+        "SignalAcronym NOT IN ('STAT')",
+        "PhasorSourceIndex = Null",
+        "UpdatedOn > #2019-01-01#"
+    };
+
+    for (const string& expression : compiledExpressions)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, expression);
+
+        assert(expressionTree->Compile());
+
+        for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
+        {
+            const DataRowPtr& row = measurementDetail->Row(i);
+            const Nullable<bool> compiledResult = expressionTree->EvaluatePredicate(row);
+            const ValueExpressionPtr result = expressionTree->Evaluate(row);
+
+            assert(compiledResult.HasValue() == !result->IsNull());
+            assert(!compiledResult.HasValue() || compiledResult.GetValueOrDefault() == result->ValueAsBoolean());
+        }
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 152 - test expressions with functions are not compiled and still select rows by walking the tree
+    const ExpressionTreePtr functionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "Len(SignalAcronym) = 4 AND SignalAcronym = 'STAT'");
+
+    assert(!functionTree->Compile());
+    assert(FilterExpressionParser::Select(functionTree).size() == FilterExpressionParser::Select(measurementDetail, "SignalAcronym = 'STAT'").size());
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 153 - test filters narrowed by column indexes select the same rows as table scans
+    const DataSetPtr indexedDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr indexedTable = indexedDataSet->CreateTable("ActiveMeasurements");
+    vector<GSF::Guid> indexedSignalIDs;
+
+    indexedTable->AddColumn(indexedTable->CreateColumn("SignalID", DataType::Guid));
+    indexedTable->AddColumn(indexedTable->CreateColumn("ID", DataType::String));
+    indexedTable->AddColumn(indexedTable->CreateColumn("PointTag", DataType::String));
+    indexedTable->AddColumn(indexedTable->CreateColumn("Device", DataType::String));
+    indexedTable->AddColumn(indexedTable->CreateColumn("Internal", DataType::Boolean));
+
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        dataRow = indexedTable->CreateRow();
+        indexedSignalIDs.push_back(NewGuid());
+        dataRow->SetGuidValue(0, indexedSignalIDs.back());
+        dataRow->SetStringValue(1, "PPA:" + ToString(i + 1));
+        dataRow->SetStringValue(2, "TAG" + ToString(i));
+        dataRow->SetStringValue(3, "DEV" + ToString(i % 10));
+        dataRow->SetBooleanValue(4, i % 3 == 0);
+        indexedTable->AddRow(dataRow);
+    }
+
+    indexedDataSet->AddOrUpdateTable(indexedTable);
+
+    const vector<string> indexedExpressions =
+    {
+        "PointTag = 'tag42'",
+        "PointTag === 'tag42'",
+        "Device IN ('DEV1', 'dev3', 'DEV11')",
+        "Device = 'DEV1' AND Internal",
+        "Device = 'DEV2' OR PointTag = 'TAG5'",
+        "SignalID = '" + ToString(indexedSignalIDs[7]) + "' OR SignalID = '" + ToString(indexedSignalIDs[993]) + "'",
+        "Device = 'DEV4' OR Internal"
+    };
+
+    vector<vector<DataRowPtr>> scannedRows;
+
+    for (const string& expression : indexedExpressions)
+        scannedRows.push_back(FilterExpressionParser::Select(indexedTable, expression));
+
+    indexedTable->CreateIndex("SignalID");
+    indexedTable->CreateIndex("PointTag");
+    indexedTable->CreateIndex("Device");
+
+    assert(indexedTable->HasIndex(indexedTable->Column("Device")->Index()));
+    assert(!indexedTable->HasIndex(indexedTable->Column("ID")->Index()));
+
+    for (size_t i = 0; i < indexedExpressions.size(); i++)
+        assert(FilterExpressionParser::Select(indexedTable, indexedExpressions[i]) == scannedRows[i]);
+
+    assert(scannedRows[0].size() == 1);
+    assert(scannedRows[1].empty());
+    assert(scannedRows[2].size() == 200);
+    assert(scannedRows[5].size() == 2);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 154 - test indexes are kept current as rows are added and updated
+    const int32_t pointTagField = indexedTable->Column("PointTag")->Index();
+    const int32_t indexedSignalIDField = indexedTable->Column("SignalID")->Index();
+    vector<int32_t> rowIndexes;
+
+    dataRow = indexedTable->CreateRow();
+    indexedSignalIDs.push_back(NewGuid());
+    dataRow->SetGuidValue(indexedSignalIDField, indexedSignalIDs.back());
+    dataRow->SetStringValue(pointTagField, string("ADDED"));
+    indexedTable->AddRow(dataRow);
+
+    assert(indexedTable->TryFindRows(pointTagField, "added", rowIndexes));
+    assert(rowIndexes.size() == 1 && rowIndexes[0] == 1000);
+
+    rowIndexes.clear();
+    assert(indexedTable->TryFindRows(indexedSignalIDField, indexedSignalIDs.back(), rowIndexes));
+    assert(rowIndexes.size() == 1 && rowIndexes[0] == 1000);
+
+    indexedTable->Row(42)->SetStringValue(pointTagField, string("RENAMED"));
+
+    rowIndexes.clear();
+    assert(indexedTable->TryFindRows(pointTagField, "RENAMED", rowIndexes));
+    assert(rowIndexes.size() == 1 && rowIndexes[0] == 42);
+
+    rowIndexes.clear();
+    assert(indexedTable->TryFindRows(pointTagField, "TAG42", rowIndexes));
+    assert(rowIndexes.empty());
+
+    assert(FilterExpressionParser::Select(indexedTable, "PointTag = 'renamed'").size() == 1);
+    assert(!indexedTable->TryFindRows(indexedTable->Column("ID")->Index(), "PPA:1", rowIndexes));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 155 - test identifier lookups that index their columns on first use from concurrent parsers
+    const DataSetPtr lookupDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr lookupTable = lookupDataSet->CreateTable("ActiveMeasurements");
+
+    for (const DataColumnPtr& column : { indexedTable->Column("SignalID"), indexedTable->Column("ID"), indexedTable->Column("PointTag") })
+        lookupTable->AddColumn(lookupTable->CreateColumn(column->Name(), column->Type()));
+
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        dataRow = lookupTable->CreateRow();
+        dataRow->SetGuidValue(0, indexedSignalIDs[i]);
+        dataRow->SetStringValue(1, "PPA:" + ToString(i + 1));
+        dataRow->SetStringValue(2, "TAG" + ToString(i));
+        lookupTable->AddRow(dataRow);
+    }
+
+    lookupDataSet->AddOrUpdateTable(lookupTable);
+
+    atomic<int32_t> lookupFailures(0);
+    vector<Thread> lookupThreads;
+
+    for (int32_t i = 0; i < 8; i++)
+    {
+        lookupThreads.emplace_back([&, i]
+        {
+            for (int32_t j = 0; j < 50; j++)
+            {
+                const int32_t row = (i * 97 + j * 13) % 1000;
+                const string filterExpression = ToString(indexedSignalIDs[row]) + ";\"TAG" + ToString(row) + "\";PPA:" + ToString(row + 1);
+                const vector<DataRowPtr> rows = FilterExpressionParser::Select(lookupDataSet, filterExpression, "ActiveMeasurements");
+
+                if (rows.size() != 1 || rows[0] != lookupTable->Row(row))
+                    ++lookupFailures;
+            }
+        });
+    }
+
+    for (Thread& thread : lookupThreads)
+        thread.join();
+
+    assert(lookupFailures == 0);
+    assert(lookupTable->HasIndex(lookupTable->Column("SignalID")->Index()));
+    assert(lookupTable->HasIndex(lookupTable->Column("PointTag")->Index()));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
     // Wait until the user presses enter before quitting.
     cout << endl << "Tests complete. Press enter to exit." << endl;
     string line;
@@ -0,0 +1,385 @@
+//******************************************************************************************************
+//  FrameAlignerTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../Transport/FrameAssembler.h"
+#include "../Transport/FrameConcentrator.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Slot of frame aligner tests, values are the timestamps added to the slot.
+struct TestSlot
+{
+    int64_t Timestamp;
+    vector<int64_t> Values;
+
+    void Clear()
+    {
+        Values.clear();
+    }
+};
+
+// Frame published by the frame assembler, copied since device frames are only valid during the callback.
+struct AssembledFrame
+{
+    int64_t Timestamp;
+    vector<string> DeviceAcronyms;
+    size_t MeasurementCount;
+};
+
+MeasurementValue CreateMeasurementValue(const Guid& signalID, int64_t timestamp, float64_t value)
+{
+    MeasurementValue measurement {};
+
+    measurement.SignalID = signalID;
+    measurement.Timestamp = timestamp;
+    measurement.Value = value;
+
+    return measurement;
+}
+
+Measurement CreateMeasurement(const Guid& signalID, int64_t timestamp, float64_t value)
+{
+    Measurement measurement;
+
+    measurement.SignalID = signalID;
+    measurement.Timestamp = timestamp;
+    measurement.Value = value;
+
+    return measurement;
+}
+
+ConfigurationFramePtr CreateConfigurationFrame(const string& deviceAcronym, const vector<Guid>& signalIDs)
+{
+    ConfigurationFramePtr configurationFrame = NewSharedPtr<ConfigurationFrame>();
+
+    configurationFrame->DeviceAcronym = deviceAcronym;
+    configurationFrame->Measurements.insert(signalIDs.begin(), signalIDs.end());
+
+    return configurationFrame;
+}
+
+// Tests the time alignment core, and frames assembled from received measurements and concentrated from published measurements.
+int main(int argc, char* argv[])
+{
+    const Guid signalA1 = NewGuid(), signalA2 = NewGuid(), signalB1 = NewGuid();
+    const int64_t interval = Ticks::PerSecond / 2;
+    const int64_t baseTime = ToTicks(UtcNow()) - 100 * Ticks::PerSecond;
+
+    GSF::StringMap<ConfigurationFramePtr> configurationFrames;
+    configurationFrames["DEVA"] = CreateConfigurationFrame("DEVA", { signalA1, signalA2 });
+    configurationFrames["DEVB"] = CreateConfigurationFrame("DEVB", { signalB1 });
+
+    vector<AssembledFrame> frames;
+
+    const auto recordFrames = [&frames](FrameAssembler*, int64_t timestamp, const vector<DeviceFrame*>& deviceFrames)
+    {
+        AssembledFrame frame { timestamp, {}, 0 };
+
+        for (const DeviceFrame* deviceFrame : deviceFrames)
+        {
+            assert(deviceFrame->Timestamp == timestamp);
+            frame.DeviceAcronyms.push_back(deviceFrame->Configuration->DeviceAcronym);
+            frame.MeasurementCount += deviceFrame->Measurements.size();
+        }
+
+        frames.push_back(frame);
+    };
+
+    int32_t test = 0;
+
+    // Test 1
+    {
+        // Measurements are grouped by timestamp and device, frames are published in timestamp order
+        FrameAssembler frameAssembler(1.0, 5.0, false);
+        frameAssembler.DefineConfigurationFrames(configurationFrames);
+        frameAssembler.RegisterNewFramesCallback(recordFrames);
+        frames.clear();
+
+        const vector<MeasurementValue> measurements =
+        {
+            CreateMeasurementValue(signalA1, baseTime + interval, 1.0),
+            CreateMeasurementValue(signalA1, baseTime, 2.0),
+            CreateMeasurementValue(signalB1, baseTime, 3.0),
+            CreateMeasurementValue(signalA2, baseTime, 4.0),
+            CreateMeasurementValue(NewGuid(), baseTime, 5.0)
+        };
+
+        frameAssembler.AddMeasurements(measurements.data(), static_cast<uint32_t>(measurements.size()));
+        assert(frames.empty());
+
+        // Real time moves one lag time past the first frame
+        const MeasurementValue next = CreateMeasurementValue(signalB1, baseTime + 2 * interval, 6.0);
+        frameAssembler.AddMeasurements(&next, 1);
+
+        assert(frames.size() == 1);
+        assert(frames[0].Timestamp == baseTime);
+        assert(frames[0].MeasurementCount == 3);
+        assert(frames[0].DeviceAcronyms.size() == 2);
+
+        frameAssembler.Flush();
+
+        assert(frames.size() == 3);
+        assert(frames[1].Timestamp == baseTime + interval);
+        assert(frames[2].Timestamp == baseTime + 2 * interval);
+        assert(frames[2].DeviceAcronyms == vector<string> { "DEVB" });
+        assert(frameAssembler.GetPublishedFrames() == 3);
+        assert(frameAssembler.GetDiscardedMeasurements() == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 2
+    {
+        // Late measurements and measurements too far ahead of the local clock are discarded
+        FrameAssembler frameAssembler(1.0, 5.0, false);
+        frameAssembler.DefineConfigurationFrames(configurationFrames);
+        frameAssembler.RegisterNewFramesCallback(recordFrames);
+        frames.clear();
+
+        const vector<MeasurementValue> measurements =
+        {
+            CreateMeasurementValue(signalA1, baseTime, 1.0),
+            CreateMeasurementValue(signalA1, baseTime + 4 * interval, 2.0),
+            CreateMeasurementValue(signalA2, baseTime + interval, 3.0),
+            CreateMeasurementValue(signalB1, ToTicks(UtcNow()) + 60 * Ticks::PerSecond, 4.0)
+        };
+
+        frameAssembler.AddMeasurements(measurements.data(), static_cast<uint32_t>(measurements.size()));
+        assert(frameAssembler.GetDiscardedMeasurements() == 2);
+
+        const MeasurementValue late = CreateMeasurementValue(signalB1, baseTime, 5.0);
+        frameAssembler.AddMeasurements(&late, 1);
+
+        assert(frameAssembler.GetDiscardedMeasurements() == 3);
+        assert(frames.size() == 1);
+        assert(frames[0].MeasurementCount == 1);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 3
+    {
+        // Flush resets real time so that replayed data is not rejected as late
+        FrameAssembler frameAssembler(1.0, 5.0, false);
+        frameAssembler.DefineConfigurationFrames(configurationFrames);
+        frameAssembler.RegisterNewFramesCallback(recordFrames);
+        frames.clear();
+
+        vector<MeasurementValue> measurements;
+
+        for (int32_t i = 0; i < 3; i++)
+            measurements.push_back(CreateMeasurementValue(signalA1, baseTime + i * interval, i));
+
+        frameAssembler.AddMeasurements(measurements.data(), static_cast<uint32_t>(measurements.size()));
+        assert(frames.size() == 1);
+
+        frameAssembler.Flush();
+        assert(frames.size() == 3);
+
+        frameAssembler.AddMeasurements(measurements.data(), 1);
+        assert(frameAssembler.GetDiscardedMeasurements() == 0);
+
+        frameAssembler.Flush();
+        assert(frames.size() == 4);
+        assert(frames[3].Timestamp == baseTime);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 4
+    {
+        // Reset discards pending frames, redefining configuration frames does the same
+        FrameAssembler frameAssembler(1.0, 5.0, false);
+        frameAssembler.DefineConfigurationFrames(configurationFrames);
+        frameAssembler.RegisterNewFramesCallback(recordFrames);
+        frames.clear();
+
+        const MeasurementValue measurement = CreateMeasurementValue(signalA1, baseTime, 1.0);
+
+        frameAssembler.AddMeasurements(&measurement, 1);
+        frameAssembler.Reset();
+        frameAssembler.Flush();
+        assert(frames.empty());
+
+        frameAssembler.AddMeasurements(&measurement, 1);
+        frameAssembler.DefineConfigurationFrames(configurationFrames);
+        frameAssembler.Flush();
+        assert(frames.empty());
+        assert(frameAssembler.GetPublishedFrames() == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 5
+    {
+        // With the local clock as real time, frames are published on time while no data is received
+        FrameAssembler frameAssembler(0.1, 5.0, true);
+        frameAssembler.DefineConfigurationFrames(configurationFrames);
+        frameAssembler.RegisterNewFramesCallback(recordFrames);
+        frames.clear();
+
+        const MeasurementValue measurement = CreateMeasurementValue(signalB1, ToTicks(UtcNow()), 1.0);
+
+        frameAssembler.AddMeasurements(&measurement, 1);
+        frameAssembler.PublishReadyFrames();
+        assert(frames.empty());
+
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(200));
+        frameAssembler.PublishReadyFrames();
+        assert(frames.size() == 1);
+        assert(frames[0].Timestamp == measurement.Timestamp);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 6
+    {
+        // Frame aligner publishes slots in timestamp order regardless of arrival order, and reuses them
+        vector<int64_t> publishedTimestamps;
+        vector<TestSlot*> publishedSlots;
+
+        FrameAligner<TestSlot> frameAligner([&](TestSlot& slot)
+        {
+            assert(slot.Values.size() == 1 && slot.Values[0] == slot.Timestamp);
+            publishedTimestamps.push_back(slot.Timestamp);
+            publishedSlots.push_back(&slot);
+        }, 30, 1.0, 5.0, false);
+
+        const vector<int64_t> timestamps = { baseTime + 3, baseTime + 1, baseTime + 2 };
+        int64_t realTime = frameAligner.GetRealTime(ToTicks(UtcNow()));
+
+        for (const int64_t timestamp : timestamps)
+        {
+            const bool accepted = frameAligner.TryAccept(timestamp, timestamp, ToTicks(UtcNow()), realTime);
+            assert(accepted);
+            frameAligner.GetSlot(timestamp).Values.push_back(timestamp);
+        }
+
+        assert(realTime == baseTime + 3);
+        frameAligner.Advance(realTime);
+        assert(publishedTimestamps.empty());
+
+        frameAligner.Flush();
+        assert((publishedTimestamps == vector<int64_t> { baseTime + 1, baseTime + 2, baseTime + 3 }));
+
+        // Published slots are cleared for reuse, keeping their buffers
+        TestSlot& reusedSlot = frameAligner.GetSlot(baseTime + 10);
+        assert(reusedSlot.Values.empty() && reusedSlot.Values.capacity() > 0);
+        assert(find(publishedSlots.begin(), publishedSlots.end(), &reusedSlot) != publishedSlots.end());
+        assert(frameAligner.GetPublishedFrames() == 3);
+        assert(frameAligner.GetFrameInterval() == 33);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 7
+    {
+        // Frame concentrator rounds timestamps to the frame rate and keeps the latest measurement of each signal
+        const int64_t frameTime = baseTime - baseTime % Ticks::PerSecond;
+        const int64_t frameTicks = Ticks::PerSecond / 30;
+        SignalIndexCache signalIndexCache;
+        vector<ConcentratedFrame> concentratedFrames;
+
+        signalIndexCache.AddMeasurementKey(0, signalA1, "PPA", 1);
+        signalIndexCache.AddMeasurementKey(1, signalB1, "PPA", 2);
+
+        FrameConcentrator frameConcentrator(30, 1.0, 5.0, false);
+        frameConcentrator.RegisterNewFrameCallback([&](FrameConcentrator*, const ConcentratedFrame& frame) { concentratedFrames.push_back(frame); });
+
+        const vector<Measurement> measurements =
+        {
+            CreateMeasurement(signalA1, frameTime + 1, 1.0),
+            CreateMeasurement(signalB1, frameTime + 10000, 2.0),
+            CreateMeasurement(signalA1, frameTime - 10000, 3.0),
+            CreateMeasurement(signalA2, frameTime, 4.0),
+            CreateMeasurement(signalA1, frameTime + frameTicks + 10, 5.0)
+        };
+
+        frameConcentrator.AddMeasurements(measurements, signalIndexCache);
+        assert(concentratedFrames.empty());
+
+        frameConcentrator.AddMeasurements(vector<Measurement> { CreateMeasurement(signalB1, frameTime + 2 * Ticks::PerSecond, 6.0) }, signalIndexCache);
+
+        assert(concentratedFrames.size() == 2);
+        assert(concentratedFrames[0].Timestamp == frameTime);
+        assert((concentratedFrames[0].RuntimeIDs == vector<uint16_t> { 0, 1 }));
+        assert(concentratedFrames[0].Measurements[0].Value == 3.0);
+        assert(concentratedFrames[0].Measurements[1].Value == 2.0);
+        assert(concentratedFrames[1].Timestamp == frameTime + frameTicks);
+        assert(concentratedFrames[1].Measurements.size() == 1);
+
+        frameConcentrator.Flush();
+        assert(concentratedFrames.size() == 3);
+        assert(concentratedFrames[2].Timestamp == frameTime + 2 * Ticks::PerSecond);
+        assert(frameConcentrator.GetDiscardedMeasurements() == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 8
+    {
+        // Frame concentrator fed by measurement pointers discards late measurements, and
+        // positions of reused slots are reset so that signals are not mixed across frames
+        const int64_t frameTime = baseTime - baseTime % Ticks::PerSecond;
+        SignalIndexCache signalIndexCache;
+        vector<ConcentratedFrame> concentratedFrames;
+
+        signalIndexCache.AddMeasurementKey(0, signalA1, "PPA", 1);
+        signalIndexCache.AddMeasurementKey(1, signalB1, "PPA", 2);
+
+        FrameConcentrator frameConcentrator(10, 0.5, 5.0, false);
+        frameConcentrator.RegisterNewFrameCallback([&](FrameConcentrator*, const ConcentratedFrame& frame) { concentratedFrames.push_back(frame); });
+
+        for (int32_t i = 0; i < 20; i++)
+        {
+            const int64_t timestamp = frameTime + i * Ticks::PerSecond / 10;
+            vector<MeasurementPtr> measurements = { NewSharedPtr<Measurement>(CreateMeasurement(i % 2 == 0 ? signalA1 : signalB1, timestamp, i)) };
+
+            frameConcentrator.AddMeasurements(measurements, signalIndexCache);
+        }
+
+        frameConcentrator.AddMeasurements(vector<MeasurementPtr> { NewSharedPtr<Measurement>(CreateMeasurement(signalB1, frameTime, 0.0)) }, signalIndexCache);
+        frameConcentrator.Flush();
+
+        assert(concentratedFrames.size() == 20);
+        assert(frameConcentrator.GetDiscardedMeasurements() == 1);
+
+        for (int32_t i = 0; i < 20; i++)
+        {
+            assert(concentratedFrames[i].Measurements.size() == 1);
+            assert(concentratedFrames[i].RuntimeIDs[0] == i % 2);
+            assert(concentratedFrames[i].Measurements[0].Value == i);
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+//******************************************************************************************************
+//  RingBufferTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <atomic>
+
+#include "../Common/RingBuffer.h"
+
+using namespace std;
+using namespace GSF;
+
+// Tests the overflow policies, bulk dequeue and blocking behavior of the RingBuffer.
+int main(int argc, char* argv[])
+{
+    int32_t test = 0;
+
+    // Test 1
+    {
+        // Capacity is rounded up to the next power of two
+        RingBuffer<int32_t> queue(5);
+        int32_t item;
+
+        assert(queue.Capacity() == 8);
+        assert(queue.Size() == 0);
+        assert(!queue.TryDequeue(item));
+
+        for (int32_t i = 0; i < 8; i++)
+        {
+            const bool enqueued = queue.TryEnqueue(int32_t(i));
+            assert(enqueued);
+        }
+
+        // TryEnqueue never applies the overflow policy
+        const bool enqueued = queue.TryEnqueue(8);
+        assert(!enqueued);
+        assert(queue.Size() == 8);
+        assert(queue.GetDroppedCount() == 0);
+
+        for (int32_t i = 0; i < 8; i++)
+        {
+            const bool dequeued = queue.TryDequeue(item);
+            assert(dequeued && item == i);
+        }
+
+        assert(!queue.TryDequeue(item));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 2
+    {
+        RingBuffer<int32_t> queue(4, QueueOverflowPolicy::DropOldest);
+        vector<int32_t> items;
+
+        for (int32_t i = 0; i < 10; i++)
+        {
+            const bool enqueued = queue.Enqueue(i);
+            assert(enqueued);
+        }
+
+        assert(queue.GetDroppedCount() == 6);
+
+        const uint32_t count = queue.TryDequeueBulk(items, 100);
+        assert(count == 4);
+        assert((items == vector<int32_t> { 6, 7, 8, 9 }));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 3
+    {
+        RingBuffer<int32_t> queue(8, QueueOverflowPolicy::DropNewest);
+        vector<int32_t> items;
+
+        for (int32_t i = 0; i < 10; i++)
+        {
+            const bool enqueued = queue.Enqueue(i);
+            assert(enqueued == i < 8);
+        }
+
+        assert(queue.GetDroppedCount() == 2);
+
+        // Bulk dequeue stops at maxCount and appends to the vector
+        uint32_t count = queue.TryDequeueBulk(items, 5);
+        assert(count == 5 && items.size() == 5);
+        assert(items[0] == 0 && items[4] == 4);
+
+        count = queue.TryDequeueBulk(items, 100);
+        assert(count == 3 && items.size() == 8);
+        assert(items[7] == 7);
+
+        count = queue.TryDequeueBulk(items, 100);
+        assert(count == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 4
+    {
+        // Blocked producers wait for the consumer instead of dropping items
+        const int32_t itemCount = 100000;
+        const int32_t producerCount = 4;
+        RingBuffer<int32_t> queue(4, QueueOverflowPolicy::Block);
+        vector<Thread> producers;
+        int64_t sum = 0;
+        int32_t received = 0;
+
+        Thread consumer([&]
+        {
+            vector<int32_t> items;
+
+            while (received < itemCount * producerCount)
+            {
+                queue.WaitForData();
+                items.clear();
+                queue.TryDequeueBulk(items, 16);
+
+                for (int32_t item : items)
+                {
+                    sum += item;
+                    received++;
+                }
+            }
+        });
+
+        for (int32_t i = 0; i < producerCount; i++)
+        {
+            producers.emplace_back([&]
+            {
+                for (int32_t item = 1; item <= itemCount; item++)
+                    queue.Enqueue(item);
+            });
+        }
+
+        for (Thread& producer : producers)
+            producer.join();
+
+        consumer.join();
+
+        assert(sum == int64_t(producerCount) * itemCount * (itemCount + 1) / 2);
+        assert(queue.GetDroppedCount() == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 5
+    {
+        // Consumer enqueuing into its own full queue drops the item rather than deadlocking
+        RingBuffer<int32_t> queue(2, QueueOverflowPolicy::Block);
+
+        queue.Enqueue(1);
+        queue.Enqueue(2);
+        queue.WaitForData();
+
+        const bool enqueued = queue.Enqueue(3);
+        assert(!enqueued);
+        assert(queue.GetDroppedCount() == 1);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 6
+    {
+        // Release wakes a producer blocked on a full queue
+        RingBuffer<int32_t> queue(2, QueueOverflowPolicy::Block);
+        atomic<bool> enqueued(true);
+
+        queue.Enqueue(1);
+        queue.Enqueue(2);
+
+        Thread producer([&]
+        {
+            enqueued = queue.Enqueue(3);
+        });
+
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+        queue.Release();
+        producer.join();
+
+        assert(!enqueued);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
@@ -0,0 +1,333 @@
+//******************************************************************************************************
+//  SendQueueTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <atomic>
+
+#include "../Transport/DataPublisher.h"
+#include "../Transport/DataSubscriber.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+static const uint32_t MeasurementCount = 1000;
+static const uint32_t MaxSendQueueSize = 8;
+
+// Forwards a single subscriber connection to the publisher. While stalled, nothing more is read
+// from the publisher, so the publisher's send queue fills as it would for a subscriber that
+// has stopped reading.
+class StallingProxy
+{
+private:
+    IOContext m_service;
+    TcpAcceptor m_acceptor;
+    TcpSocket m_subscriberSocket;
+    TcpSocket m_publisherSocket;
+    Thread m_upstreamThread;
+    Thread m_downstreamThread;
+    atomic<bool> m_stalled;
+
+    // Forwards subscriber commands, closing the publisher connection once the subscriber disconnects.
+    void ForwardUpstream()
+    {
+        vector<uint8_t> buffer(8192);
+        ErrorCode error;
+
+        while (true)
+        {
+            const size_t length = m_subscriberSocket.read_some(boost::asio::buffer(buffer), error);
+
+            if (error || boost::asio::write(m_publisherSocket, boost::asio::buffer(buffer, length), error) < length)
+                break;
+        }
+
+        m_publisherSocket.shutdown(TcpSocket::shutdown_send, error);
+    }
+
+    // Forwards publisher responses, unless stalled, until the publisher closes the connection.
+    void ForwardDownstream()
+    {
+        vector<uint8_t> buffer(8192);
+        ErrorCode error;
+
+        while (true)
+        {
+            if (m_stalled)
+            {
+                boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+                continue;
+            }
+
+            const size_t length = m_publisherSocket.read_some(boost::asio::buffer(buffer), error);
+
+            if (error || boost::asio::write(m_subscriberSocket, boost::asio::buffer(buffer, length), error) < length)
+                break;
+        }
+
+        m_subscriberSocket.shutdown(TcpSocket::shutdown_send, error);
+    }
+
+public:
+    StallingProxy(uint16_t port, uint16_t publisherPort) :
+        m_acceptor(m_service, TcpEndPoint(boost::asio::ip::tcp::v4(), port)),
+        m_subscriberSocket(m_service),
+        m_publisherSocket(m_service),
+        m_stalled(false)
+    {
+        m_upstreamThread = Thread([this, publisherPort]
+        {
+            m_acceptor.accept(m_subscriberSocket);
+
+            // Small receive buffer so that the publisher cannot hide a stall in socket buffers
+            m_publisherSocket.open(boost::asio::ip::tcp::v4());
+            m_publisherSocket.set_option(boost::asio::socket_base::receive_buffer_size(4096));
+            m_publisherSocket.connect(TcpEndPoint(boost::asio::ip::make_address("127.0.0.1"), publisherPort));
+
+            m_downstreamThread = Thread(boost::bind(&StallingProxy::ForwardDownstream, this));
+            ForwardUpstream();
+        });
+    }
+
+    // Waits for both directions to close, the subscriber must have disconnected.
+    ~StallingProxy()
+    {
+        m_stalled = false;
+        m_upstreamThread.join();
+        m_downstreamThread.join();
+    }
+
+    void SetStalled(bool stalled)
+    {
+        m_stalled = stalled;
+    }
+};
+
+// Publisher, subscriber and the stalling proxy between them, along with what the subscriber received.
+struct TestConnection
+{
+    DataPublisherPtr Publisher;
+    SharedPtr<StallingProxy> Proxy;
+    SharedPtr<DataSubscriber> Subscriber;
+    vector<MeasurementMetadataPtr> Metadata;
+
+    Mutex ValuesLock;
+    unordered_map<Guid, float64_t> LatestValues;
+    atomic<uint64_t> ReceivedCount;
+    atomic<uint32_t> SubscriberErrors;
+    atomic<bool> ClientDisconnected;
+    string PublisherErrors;
+
+    TestConnection(uint16_t port, SendQueueOverflowPolicy overflowPolicy) :
+        ReceivedCount(0UL),
+        SubscriberErrors(0U),
+        ClientDisconnected(false)
+    {
+        const DeviceMetadataPtr device = NewSharedPtr<DeviceMetadata>();
+        device->Acronym = "TEST";
+        device->Name = "Send Queue Test Device";
+        device->UniqueID = NewGuid();
+        device->FramesPerSecond = 30;
+
+        for (uint32_t i = 0; i < MeasurementCount; i++)
+        {
+            const MeasurementMetadataPtr measurement = NewSharedPtr<MeasurementMetadata>();
+            measurement->DeviceAcronym = device->Acronym;
+            measurement->ID = "TEST:" + ToString(i + 1);
+            measurement->SignalID = NewGuid();
+            measurement->PointTag = "TEST-AV" + ToString(i + 1);
+            measurement->Reference = SignalReference(measurement->PointTag);
+            Metadata.push_back(measurement);
+        }
+
+        Publisher = NewSharedPtr<DataPublisher>(port);
+        Publisher->SetMaxSendQueueSize(MaxSendQueueSize);
+        Publisher->SetSendQueueOverflowPolicy(overflowPolicy);
+        Publisher->SetMaxSendQueueLagTime(0.0);
+        Publisher->DefineMetadata({ device }, Metadata, {});
+        Publisher->RegisterErrorMessageCallback([this](DataPublisher*, const string& message)
+        {
+            ScopeLock lock(ValuesLock);
+            PublisherErrors += message + "\n";
+        });
+
+        Publisher->RegisterClientDisconnectedCallback([this](DataPublisher*, const Guid&, const string&) { ClientDisconnected = true; });
+
+        Proxy = NewSharedPtr<StallingProxy>(port + 1, port);
+
+        Subscriber = NewSharedPtr<DataSubscriber>();
+        Subscriber->RegisterErrorMessageCallback([this](DataSubscriber*, const string& message)
+        {
+            cerr << "Subscriber error: " << message << endl;
+            ++SubscriberErrors;
+        });
+
+        Subscriber->RegisterNewMeasurementsCallback([this](DataSubscriber*, const vector<MeasurementPtr>& measurements)
+        {
+            ScopeLock lock(ValuesLock);
+
+            for (const MeasurementPtr& measurement : measurements)
+                LatestValues[measurement->SignalID] = measurement->Value;
+
+            ReceivedCount += measurements.size();
+        });
+
+        SubscriptionInfo info;
+        info.FilterExpression = "FILTER ActiveMeasurements WHERE Device = 'TEST'";
+
+        Subscriber->Connect("127.0.0.1", port + 1);
+        Subscriber->Subscribe(info);
+    }
+
+    ~TestConnection()
+    {
+        Subscriber->Disconnect();
+        Proxy.reset();
+        Subscriber.reset();
+        Publisher.reset();
+    }
+
+    void Publish(float64_t value)
+    {
+        const int64_t timestamp = ToTicks(UtcNow());
+        vector<Measurement> measurements(MeasurementCount);
+
+        for (uint32_t i = 0; i < MeasurementCount; i++)
+        {
+            measurements[i].SignalID = Metadata[i]->SignalID;
+            measurements[i].Timestamp = timestamp;
+            measurements[i].Value = value + i;
+        }
+
+        Publisher->PublishMeasurements(measurements);
+    }
+
+    string GetPublisherErrors()
+    {
+        ScopeLock lock(ValuesLock);
+        return PublisherErrors;
+    }
+
+    // Determines whether the last value received for every measurement is the one published for the given value.
+    bool Received(float64_t value)
+    {
+        ScopeLock lock(ValuesLock);
+
+        for (uint32_t i = 0; i < MeasurementCount; i++)
+        {
+            const auto iterator = LatestValues.find(Metadata[i]->SignalID);
+
+            if (iterator == LatestValues.end() || iterator->second != value + i)
+                return false;
+        }
+
+        return true;
+    }
+
+    // Publishes until the condition holds, returns false when it does not hold within the timeout.
+    template<typename TCondition>
+    bool PublishUntil(TCondition condition, float64_t value, int32_t sleepMilliseconds = 10, int32_t timeoutSeconds = 30)
+    {
+        const int64_t timeout = ToTicks(UtcNow()) + timeoutSeconds * Ticks::PerSecond;
+
+        while (!condition())
+        {
+            if (ToTicks(UtcNow()) > timeout)
+                return false;
+
+            Publish(value);
+            value += 0.001;
+
+            if (sleepMilliseconds > 0)
+                boost::this_thread::sleep_for(boost::chrono::milliseconds(sleepMilliseconds));
+        }
+
+        return true;
+    }
+};
+
+// Tests that the send queue of a subscriber that stops reading stays bounded by the overflow policy.
+int main(int argc, char* argv[])
+{
+    int32_t test = 0;
+
+    // Test 1
+    {
+        // Data packets are dropped from a full queue, and a subscriber that resumes reading decodes new data
+        TestConnection connection(36610, SendQueueOverflowPolicy::DropOldest);
+
+        bool succeeded = connection.PublishUntil([&] { return connection.ReceivedCount > 0; }, 0.0);
+        assert(succeeded);
+
+        connection.Proxy->SetStalled(true);
+
+        succeeded = connection.PublishUntil([&] { return connection.Publisher->GetTotalDataPacketsDropped() > 100; }, 10000.0, 0);
+        assert(succeeded);
+        assert(connection.Publisher->GetPeakSendQueueDepth() <= MaxSendQueueSize);
+        assert(!connection.ClientDisconnected);
+
+        connection.Proxy->SetStalled(false);
+
+        succeeded = connection.PublishUntil([&] { return connection.Received(1000000.0); }, 1000000.0, 50);
+        assert(succeeded);
+
+        // Values of later batches are only received once the backlog of the stall has been decoded
+        const float64_t lastValue = 2000000.0;
+        connection.Publish(lastValue);
+
+        succeeded = connection.PublishUntil([&] { return connection.Received(lastValue); }, lastValue, 50);
+        assert(succeeded);
+        assert(connection.SubscriberErrors == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 2
+    {
+        // Subscriber that fills its queue is disconnected when the overflow policy is to disconnect
+        TestConnection connection(36620, SendQueueOverflowPolicy::Disconnect);
+
+        bool succeeded = connection.PublishUntil([&] { return connection.ReceivedCount > 0; }, 0.0);
+        assert(succeeded);
+
+        connection.Proxy->SetStalled(true);
+
+        succeeded = connection.PublishUntil([&] { return connection.ClientDisconnected.load(); }, 10000.0, 0);
+        assert(succeeded);
+        assert(connection.GetPublisherErrors().find("exceeded send queue size of " + ToString(MaxSendQueueSize)) != string::npos);
+        assert(connection.Publisher->GetTotalDataPacketsDropped() == 0);
+
+        connection.Proxy->SetStalled(false);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
@@ -0,0 +1,339 @@
+//******************************************************************************************************
+//  TSSCTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <cassert>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <cstring>
+#include <boost/chrono.hpp>
+
+#include "../Transport/TSSCMeasurementEncoder.h"
+#include "../Transport/Constants.h"
+#include "TSSCBaselineParser.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+typedef boost::chrono::steady_clock Clock;
+
+struct TestMeasurement
+{
+    uint16_t ID;
+    int64_t Timestamp;
+    uint32_t Quality;
+    float32_t Value;
+};
+
+typedef vector<vector<uint8_t>> EncodedBlocks;
+
+// Generates frames of measurements resembling streaming phasor data: most values change slightly from one
+// frame to the next, while quality flags, timestamps and point IDs occasionally change in irregular ways.
+vector<TestMeasurement> GenerateMeasurements(uint32_t frameCount, uint32_t pointCount, uint32_t seed)
+{
+    mt19937 random(seed);
+    vector<TestMeasurement> measurements;
+    vector<float32_t> values(pointCount);
+    int64_t timestamp = 637000000000000000LL;
+
+    for (float32_t& value : values)
+        value = static_cast<float32_t>(random() % 100000) / 7.0F;
+
+    for (uint32_t frame = 0; frame < frameCount; frame++)
+    {
+        timestamp += frame % 3 == 2 ? 333334 : 333333;
+
+        // Occasionally step back in time, as with out of order frames
+        if (frame % 500 == 499)
+            timestamp -= 1234567;
+
+        for (uint32_t i = 0; i < pointCount; i++)
+        {
+            if (random() % 10 == 0)
+                continue;
+
+            float32_t& value = values[i];
+
+            if (random() % 3 == 0)
+                value += static_cast<float32_t>(static_cast<int32_t>(random() % 100) - 50) / 1000.0F;
+
+            TestMeasurement measurement;
+
+            // Point IDs above 4095 need the widest point ID code words
+            measurement.ID = static_cast<uint16_t>(i * 37 % 1000 + (i > pointCount * 5 / 6 ? 40000 : 0));
+            measurement.Timestamp = timestamp + (random() % 200 == 0 ? 12345 : 0);
+            measurement.Quality = random() % 100 == 0 ? static_cast<uint32_t>(random()) : 0U;
+
+            switch (random() % 97)
+            {
+                case 0:
+                    measurement.Value = 0.0F;
+                    break;
+                case 1:
+                    measurement.Value = numeric_limits<float32_t>::quiet_NaN();
+                    break;
+                case 2:
+                    measurement.Value = static_cast<float32_t>(random());
+                    break;
+                default:
+                    measurement.Value = value;
+                    break;
+            }
+
+            measurements.push_back(measurement);
+        }
+    }
+
+    return measurements;
+}
+
+// Encodes the measurements into blocks of at most the given size, as the publisher does for data packets.
+EncodedBlocks Encode(TSSCMeasurementEncoder& encoder, const vector<TestMeasurement>& measurements, uint32_t blockSize)
+{
+    EncodedBlocks blocks;
+    vector<uint8_t> buffer(blockSize);
+
+    encoder.SetBuffer(buffer.data(), 0, blockSize);
+
+    for (const TestMeasurement& measurement : measurements)
+    {
+        if (encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value))
+            continue;
+
+        blocks.emplace_back(buffer.begin(), buffer.begin() + encoder.FinishBlock());
+        encoder.SetBuffer(buffer.data(), 0, blockSize);
+
+        const bool added = encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value);
+        assert(added);
+    }
+
+    blocks.emplace_back(buffer.begin(), buffer.begin() + encoder.FinishBlock());
+
+    return blocks;
+}
+
+// Decodes the blocks in order with the given parser, which is either the current or the baseline parser.
+template<typename TParser>
+vector<TestMeasurement> Decode(TParser& parser, EncodedBlocks& blocks)
+{
+    vector<TestMeasurement> measurements;
+    TestMeasurement measurement;
+
+    for (vector<uint8_t>& block : blocks)
+    {
+        parser.SetBuffer(block.data(), 0, static_cast<uint32_t>(block.size()));
+
+        while (parser.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value))
+            measurements.push_back(measurement);
+    }
+
+    return measurements;
+}
+
+// Decodes the blocks in order without keeping the measurements, so that only the parser is measured.
+template<typename TParser>
+size_t DecodeCount(TParser& parser, EncodedBlocks& blocks)
+{
+    size_t count = 0;
+    TestMeasurement measurement;
+
+    for (vector<uint8_t>& block : blocks)
+    {
+        parser.SetBuffer(block.data(), 0, static_cast<uint32_t>(block.size()));
+
+        while (parser.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value))
+            count++;
+    }
+
+    return count;
+}
+
+// Values are compared bit for bit, so that NaN values must round trip exactly as well.
+bool AreEqual(const vector<TestMeasurement>& left, const vector<TestMeasurement>& right)
+{
+    if (left.size() != right.size())
+        return false;
+
+    for (size_t i = 0; i < left.size(); i++)
+    {
+        if (left[i].ID != right[i].ID || left[i].Timestamp != right[i].Timestamp || left[i].Quality != right[i].Quality)
+            return false;
+
+        if (memcmp(&left[i].Value, &right[i].Value, sizeof(float32_t)) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+template<typename TAction>
+double MeasureSeconds(TAction action)
+{
+    double bestSeconds = numeric_limits<double>::max();
+
+    // Best of several runs, so that a single slow run does not skew the results
+    for (int32_t run = 0; run < 5; run++)
+    {
+        const Clock::time_point start = Clock::now();
+        action();
+        bestSeconds = min(bestSeconds, boost::chrono::duration<double>(Clock::now() - start).count());
+    }
+
+    return bestSeconds;
+}
+
+// Tests the TSSC encoder against the current and the baseline TSSC parsers, then benchmarks them.
+int main(int argc, char* argv[])
+{
+    const vector<TestMeasurement> measurements = GenerateMeasurements(2000, 300, 42);
+    int32_t test = 0;
+
+    // Test 1
+    {
+        TSSCMeasurementEncoder encoder;
+        TSSCMeasurementParser parser;
+        EncodedBlocks blocks = Encode(encoder, measurements, Common::MaxPacketSize);
+
+        assert(blocks.size() > 1);
+        assert(AreEqual(Decode(parser, blocks), measurements));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 2
+    {
+        TSSCMeasurementEncoder encoder;
+        Baseline::TSSCMeasurementParser parser;
+        EncodedBlocks blocks = Encode(encoder, measurements, Common::MaxPacketSize);
+
+        assert(AreEqual(Decode(parser, blocks), measurements));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 3
+    {
+        // Small blocks end the bit stream often and carry the coding state across many blocks
+        TSSCMeasurementEncoder encoder;
+        TSSCMeasurementParser parser;
+        Baseline::TSSCMeasurementParser baselineParser;
+        EncodedBlocks blocks = Encode(encoder, measurements, 128);
+
+        assert(blocks.size() > 1000);
+        assert(AreEqual(Decode(parser, blocks), measurements));
+        assert(AreEqual(Decode(baselineParser, blocks), measurements));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 4
+    {
+        const float32_t infinity = numeric_limits<float32_t>::infinity();
+
+        const vector<TestMeasurement> edgeCases =
+        {
+            { 0, 0, 0U, 0.0F },
+            { 0, 0, 0U, -0.0F },
+            { 1, 1, 0xFFFFFFFFU, infinity },
+            { 65535, 3155378975999999999LL, 1U, -infinity },
+            { 4096, 1, 0x80000000U, numeric_limits<float32_t>::denorm_min() },
+            { 4095, 637000000000000000LL, 127U, numeric_limits<float32_t>::max() },
+            { 16, 637000000000000000LL, 128U, -numeric_limits<float32_t>::max() },
+            { 256, 637000000000000001LL, 16384U, 1.0F },
+            { 256, 636999999999999999LL, 0U, 1.0F },
+            { 256, 636999999999999999LL, 0U, 1.0F }
+        };
+
+        TSSCMeasurementEncoder encoder;
+        TSSCMeasurementParser parser;
+        Baseline::TSSCMeasurementParser baselineParser;
+        EncodedBlocks blocks = Encode(encoder, edgeCases, Common::MaxPacketSize);
+
+        assert(AreEqual(Decode(parser, blocks), edgeCases));
+        assert(AreEqual(Decode(baselineParser, blocks), edgeCases));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 5
+    {
+        // After a reset of both sides, as on resubscribe, decoding starts over
+        TSSCMeasurementEncoder encoder;
+        TSSCMeasurementParser parser;
+        EncodedBlocks blocks = Encode(encoder, measurements, Common::MaxPacketSize);
+
+        assert(AreEqual(Decode(parser, blocks), measurements));
+
+        const vector<TestMeasurement> nextMeasurements = GenerateMeasurements(200, 100, 7);
+
+        encoder.Reset();
+        parser.Reset();
+        blocks = Encode(encoder, nextMeasurements, Common::MaxPacketSize);
+
+        assert(AreEqual(Decode(parser, blocks), nextMeasurements));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Benchmark
+    {
+        const vector<TestMeasurement> benchmarkMeasurements = GenerateMeasurements(1000, 2000, 1);
+        const double count = static_cast<double>(benchmarkMeasurements.size());
+        EncodedBlocks blocks;
+        size_t encodedBytes = 0;
+
+        const double encodeSeconds = MeasureSeconds([&]
+        {
+            TSSCMeasurementEncoder encoder;
+            blocks = Encode(encoder, benchmarkMeasurements, Common::MaxPacketSize);
+        });
+
+        for (const vector<uint8_t>& block : blocks)
+            encodedBytes += block.size();
+
+        const double decodeSeconds = MeasureSeconds([&]
+        {
+            TSSCMeasurementParser parser;
+            const size_t decodedCount = DecodeCount(parser, blocks);
+            assert(decodedCount == benchmarkMeasurements.size());
+        });
+
+        const double baselineDecodeSeconds = MeasureSeconds([&]
+        {
+            Baseline::TSSCMeasurementParser parser;
+            const size_t decodedCount = DecodeCount(parser, blocks);
+            assert(decodedCount == benchmarkMeasurements.size());
+        });
+
+        cout << endl << fixed << setprecision(2);
+        cout << "Benchmark of " << benchmarkMeasurements.size() << " measurements encoded to " << encodedBytes << " bytes (" << encodedBytes / count << " bytes per measurement):" << endl;
+        cout << "    Encoder:         " << count / encodeSeconds / 1000000.0 << " million measurements per second" << endl;
+        cout << "    Parser:          " << count / decodeSeconds / 1000000.0 << " million measurements per second" << endl;
+        cout << "    Baseline parser: " << count / baselineDecodeSeconds / 1000000.0 << " million measurements per second" << endl;
+    }
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+//******************************************************************************************************
+//  TimerSchedulerTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <atomic>
+
+#include "../Common/TimerScheduler.h"
+#include "../Common/Timer.h"
+
+using namespace std;
+using namespace GSF;
+
+void Sleep(int32_t milliseconds)
+{
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(milliseconds));
+}
+
+// Tests ordering, repetition, cancellation and unregistration of scheduled callbacks,
+// and the timers that share the default scheduler.
+int main(int argc, char* argv[])
+{
+    int32_t test = 0;
+
+    // Test 1
+    {
+        // Callbacks run in order of due time, not in order of scheduling
+        TimerScheduler scheduler;
+        Mutex firedLock;
+        vector<int32_t> fired;
+
+        const auto record = [&](int32_t value)
+        {
+            ScopeLock lock(firedLock);
+            fired.push_back(value);
+        };
+
+        const uint64_t first = scheduler.Register([&] { record(1); });
+        const uint64_t second = scheduler.Register([&] { record(2); });
+        const uint64_t third = scheduler.Register([&] { record(3); });
+
+        scheduler.Schedule(first, 150, false);
+        scheduler.Schedule(second, 50, false);
+        scheduler.Schedule(third, 100, false);
+
+        Sleep(400);
+
+        ScopeLock lock(firedLock);
+        assert((fired == vector<int32_t> { 2, 3, 1 }));
+        assert(scheduler.Count() == 3);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 2
+    {
+        // Repeating callbacks run until cancelled, a cancelled callback can be scheduled again
+        TimerScheduler scheduler;
+        atomic<int32_t> count(0);
+        const uint64_t id = scheduler.Register([&] { ++count; });
+
+        scheduler.Schedule(id, 10, true);
+        Sleep(200);
+        scheduler.Cancel(id);
+
+        const int32_t cancelledCount = count;
+        assert(cancelledCount >= 3);
+
+        Sleep(100);
+        assert(count == cancelledCount);
+
+        scheduler.Schedule(id, 10, false);
+        Sleep(100);
+        assert(count == cancelledCount + 1);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 3
+    {
+        // Rescheduling replaces the pending schedule
+        TimerScheduler scheduler;
+        atomic<int32_t> count(0);
+        const uint64_t id = scheduler.Register([&] { ++count; });
+
+        scheduler.Schedule(id, 100, false);
+        Sleep(50);
+        scheduler.Schedule(id, 200, false);
+        Sleep(100);
+        assert(count == 0);
+
+        Sleep(200);
+        assert(count == 1);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 4
+    {
+        // Callback can unregister itself without deadlocking the scheduler thread
+        TimerScheduler scheduler;
+        atomic<int32_t> count(0);
+        uint64_t id = 0;
+
+        id = scheduler.Register([&]
+        {
+            ++count;
+            scheduler.Unregister(id);
+        });
+
+        scheduler.Schedule(id, 10, true);
+        Sleep(200);
+
+        assert(count == 1);
+        assert(scheduler.Count() == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 5
+    {
+        // Unregister waits for a callback running on the scheduler thread to complete
+        TimerScheduler scheduler;
+        atomic<bool> started(false);
+        atomic<bool> completed(false);
+
+        const uint64_t id = scheduler.Register([&]
+        {
+            started = true;
+            Sleep(200);
+            completed = true;
+        });
+
+        scheduler.Schedule(id, 0, false);
+
+        while (!started)
+            Sleep(1);
+
+        scheduler.Unregister(id);
+
+        assert(completed);
+        assert(scheduler.Count() == 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 6
+    {
+        // Exception thrown by a callback does not stop other callbacks
+        TimerScheduler scheduler;
+        atomic<int32_t> count(0);
+        const uint64_t failing = scheduler.Register([] { throw runtime_error("Callback failure"); });
+        const uint64_t counting = scheduler.Register([&] { ++count; });
+
+        scheduler.Schedule(failing, 10, true);
+        scheduler.Schedule(counting, 20, true);
+        Sleep(200);
+        scheduler.Cancel(counting);
+
+        assert(count >= 3);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 7
+    {
+        // Many timers share the default scheduler instead of each owning a thread
+        const uint32_t initialCount = TimerScheduler::Default()->Count();
+        const int32_t timerCount = 200;
+        atomic<int32_t> count(0);
+
+        {
+            vector<TimerPtr> timers;
+
+            for (int32_t i = 0; i < timerCount; i++)
+            {
+                timers.push_back(NewSharedPtr<Timer>(10 + i % 20, [&](Timer*, void*) { ++count; }, true));
+                timers.back()->Start();
+            }
+
+            assert(TimerScheduler::Default()->Count() == initialCount + timerCount);
+
+            Sleep(200);
+
+            for (const TimerPtr& timer : timers)
+                timer->Stop();
+
+            assert(count >= timerCount * 3);
+        }
+
+        assert(TimerScheduler::Default()->Count() == initialCount);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 8
+    {
+        // Starting a timer without a callback fails
+        Timer timer;
+        bool failed = false;
+
+        try
+        {
+            timer.Start();
+        }
+        catch (const invalid_argument&)
+        {
+            failed = true;
+        }
+
+        assert(failed);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
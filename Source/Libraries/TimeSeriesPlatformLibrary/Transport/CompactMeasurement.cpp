@@ -136,6 +136,24 @@ uint32_t CompactMeasurement::GetBinaryLength(const bool usingBaseTimeOffset) con
 // that there is not enough data to parse the measurement. Offset and length will be
 // updated by this method to indicate how many bytes were used when parsing.
 bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementPtr& measurement) const
+{
+    MeasurementValue value;
+
+    if (!TryParseMeasurement(data, offset, length, value))
+        return false;
+
+    measurement = NewSharedPtr<Measurement>();
+    m_signalIndexCache->GetMeasurementKey(value.RuntimeID, measurement->SignalID, measurement->Source, measurement->ID);
+    measurement->Flags = value.Flags;
+    measurement->Value = value.Value;
+    measurement->Timestamp = value.Timestamp;
+
+    return true;
+}
+
+// Attempts to parse a measurement from the buffer into a plain value structure.
+// No heap allocations are performed, making this suitable for high-rate parsing.
+bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementValue& measurement) const
 {
     // Ensure that we at least have enough
     // data to read the compact state flags
@@ -160,16 +178,15 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
     const uint16_t signalIndex = EndianConverter::ToBigEndian<uint16_t>(data, offset + 1);
 
     // If the signal index is not found in the cache, we cannot parse the measurement
-    if (!m_signalIndexCache->Contains(signalIndex))
+    const SignalIndexRecord* record = m_signalIndexCache->GetRecord(signalIndex);
+
+    if (record == nullptr)
         return false;
 
-    Guid signalID;
-    string measurementSource;
-    uint32_t measurementID;
     int64_t timestamp = 0;
 
     // Now that we've validated our failure conditions we can safely start advancing the offset
-    m_signalIndexCache->GetMeasurementKey(signalIndex, signalID, measurementSource, measurementID);
+    measurement.SignalID = record->SignalID;
     offset += 3;
 
     // Read the measurement value from the buffer
@@ -201,13 +218,10 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
         }
     }
 
-    measurement = NewSharedPtr<Measurement>();
-    measurement->Flags = MapToFullFlags(compactFlags);
-    measurement->SignalID = signalID;
-    measurement->Source = measurementSource;
-    measurement->ID = measurementID;
-    measurement->Value = measurementValue;
-    measurement->Timestamp = timestamp;
+    measurement.RuntimeID = signalIndex;
+    measurement.Flags = MapToFullFlags(compactFlags);
+    measurement.Value = measurementValue;
+    measurement.Timestamp = timestamp;
 
     return true;
 }
@@ -227,7 +241,7 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
         difference = measurement.Timestamp - m_baseTimeOffsets[m_timeIndex];
         
         usingBaseTimeOffset = difference > 0 ? 
-            (m_useMillisecondResolution ? difference / Ticks::PerMillisecond < UInt16::MaxValue : difference < UInt16::MaxValue) : false;
+            (m_useMillisecondResolution ? difference / Ticks::PerMillisecond < UInt16::MaxValue : difference < UInt32::MaxValue) : false;
     }
 
     const uint32_t length = GetBinaryLength(usingBaseTimeOffset);
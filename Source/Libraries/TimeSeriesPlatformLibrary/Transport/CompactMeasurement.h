@@ -55,6 +55,10 @@ namespace Transport
         // updated by this method to indicate how many bytes were used when parsing.
         bool TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementPtr& measurement) const;
 
+        // Attempts to parse a measurement from the buffer into a plain value structure,
+        // avoiding any heap allocations. Return value semantics match the overload above.
+        bool TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementValue& measurement) const;
+
         // Serializes a measurement into a buffer
         uint32_t SerializeMeasurement(const Measurement& measurement, std::vector<uint8_t>& buffer, uint16_t runtimeID) const;
     };
@@ -220,6 +220,15 @@ namespace Transport
         Gateway
     };
 
+    // Actions taken by the DataPublisher when a subscriber connection's send queue is full.
+    enum class SendQueueOverflowPolicy
+    {
+        // Oldest queued data packet is discarded to make room.
+        DropOldest,
+        // Subscriber connection is disconnected.
+        Disconnect
+    };
+
     // The encoding commands supported by TSSC
     struct TSSCCodeWords
     {
@@ -41,6 +41,9 @@ using namespace GSF::FilterExpressions;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+// Interval, in milliseconds, between base time offset rotations
+static const int32_t BaseTimeRotationInterval = 60000;
+
 inline int32_t GetColumnIndex(const DataTablePtr& table, const string& columnName)
 {
     const DataColumnPtr& column = table->Column(columnName);
@@ -63,33 +66,111 @@ struct SubscriberConnectionInfo
     }
 };
 
-DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
+DataPublisher::DataPublisher(const TcpEndPoint& endpoint, uint32_t callbackQueueCapacity, QueueOverflowPolicy callbackQueueOverflowPolicy, uint32_t connectionThreadCount) :
     m_nodeID(NewGuid()),
+    m_publicationGroupsChanged(true),
+    m_baseTimeOffsets{0L, 0L},
+    m_timeIndex(0),
+    m_latestTimestamp(0L),
     m_securityMode(SecurityMode::None),
     m_allowMetadataRefresh(true),
     m_allowNaNValueFilter(true),
     m_forceNaNValueFilter(false),
     m_cipherKeyRotationPeriod(60000),
+    m_maxSendQueueSize(10000),
+    m_sendQueueOverflowPolicy(SendQueueOverflowPolicy::DropOldest),
+    m_maxSendQueueLagTime(0.0),
     m_userData(nullptr),
     m_disposing(false),
     m_totalCommandChannelBytesSent(0L),
     m_totalDataChannelBytesSent(0L),
     m_totalMeasurementsSent(0L),
+    m_totalDataPacketsDropped(0L),
     m_connected(false),
-    m_clientAcceptor(m_commandChannelService, endpoint)
+    m_clientAcceptor(m_commandChannelService, endpoint),
+    m_nextConnectionService(0)
 {
-    m_callbackThread = Thread(bind(&DataPublisher::RunCallbackThread, this));
+    m_baseTimeRotationTimer.SetInterval(BaseTimeRotationInterval);
+    m_baseTimeRotationTimer.SetAutoReset(true);
+    m_baseTimeRotationTimer.SetCallback(&DataPublisher::BaseTimeRotationTimerElapsed);
+    m_baseTimeRotationTimer.SetUserData(this);
+
+    m_cipherKeyRotationTimer.SetInterval(static_cast<int32_t>(m_cipherKeyRotationPeriod));
+    m_cipherKeyRotationTimer.SetAutoReset(true);
+    m_cipherKeyRotationTimer.SetCallback(&DataPublisher::CipherKeyRotationTimerElapsed);
+    m_cipherKeyRotationTimer.SetUserData(this);
+    m_cipherKeyRotationTimer.Start();
+
+    if (callbackQueueCapacity > 0)
+    {
+        m_boundedCallbackQueue = NewSharedPtr<RingBuffer<CallbackDispatcher>>(callbackQueueCapacity, callbackQueueOverflowPolicy);
+        m_callbackThread = Thread(bind(&DataPublisher::RunBoundedCallbackThread, this));
+    }
+    else
+    {
+        m_callbackThread = Thread(bind(&DataPublisher::RunCallbackThread, this));
+    }
+
+    if (connectionThreadCount == 0)
+        connectionThreadCount = max(Thread::hardware_concurrency(), 1U);
+
+    // Connection services are kept running by work guards while they have no connections
+    for (uint32_t i = 0; i < connectionThreadCount; i++)
+    {
+        m_connectionServices.push_back(NewSharedPtr<IOContext>());
+        m_connectionServiceWork.push_back(make_work_guard(*m_connectionServices.back()));
+    }
+
+    for (uint32_t i = 0; i < connectionThreadCount; i++)
+        m_connectionServiceThreads.emplace_back(bind(&DataPublisher::RunConnectionServiceThread, this, static_cast<size_t>(i)));
+
     m_commandChannelAcceptThread = Thread(bind(&DataPublisher::RunCommandChannelAcceptThread, this));
 }
 
-DataPublisher::DataPublisher(uint16_t port, bool ipV6) :
-    DataPublisher(TcpEndPoint(ipV6 ? tcp::v6() : tcp::v4(), port))
+DataPublisher::DataPublisher(uint16_t port, bool ipV6, uint32_t callbackQueueCapacity, QueueOverflowPolicy callbackQueueOverflowPolicy, uint32_t connectionThreadCount) :
+    DataPublisher(TcpEndPoint(ipV6 ? tcp::v6() : tcp::v4(), port), callbackQueueCapacity, callbackQueueOverflowPolicy, connectionThreadCount)
 {
 }
 
 DataPublisher::~DataPublisher()
 {
     m_disposing = true;
+    m_baseTimeRotationTimer.Stop();
+    m_cipherKeyRotationTimer.Stop();
+
+    // Release the callback queues so the callback thread exits before the members it uses go away,
+    // unless the last reference to the publisher is released by a callback on that thread
+    m_callbackQueue.Release();
+
+    if (m_boundedCallbackQueue != nullptr)
+        m_boundedCallbackQueue->Release();
+
+    if (m_callbackThread.joinable())
+    {
+        if (m_callbackThread.get_id() == boost::this_thread::get_id())
+            m_callbackThread.detach();
+        else
+            m_callbackThread.join();
+    }
+
+    for (auto& work : m_connectionServiceWork)
+        work.reset();
+
+    for (const auto& service : m_connectionServices)
+        service->stop();
+
+    // Last reference to the publisher can be released by a handler on a pool thread,
+    // which cannot join itself, so that thread is detached and exits once its handler returns
+    for (Thread& thread : m_connectionServiceThreads)
+    {
+        if (!thread.joinable())
+            continue;
+
+        if (thread.get_id() == boost::this_thread::get_id())
+            thread.detach();
+        else
+            thread.join();
+    }
 }
 
 DataPublisher::CallbackDispatcher::CallbackDispatcher() :
@@ -101,6 +182,11 @@ DataPublisher::CallbackDispatcher::CallbackDispatcher() :
 
 void DataPublisher::RunCallbackThread()
 {
+    // Pending callbacks are drained from the queue as a batch so that
+    // the queue lock is only acquired once per wake-up of this thread
+    queue<CallbackDispatcher> dispatchers;
+    vector<BufferPtr> buffers;
+
     while (true)
     {
         m_callbackQueue.WaitForData();
@@ -108,20 +194,81 @@ void DataPublisher::RunCallbackThread()
         if (m_disposing)
             break;
 
-        const CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
-        dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+        m_callbackQueue.DequeueAll(dispatchers);
+
+        while (!dispatchers.empty() && !m_disposing)
+        {
+            CallbackDispatcher& dispatcher = dispatchers.front();
+            dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+            buffers.push_back(std::move(dispatcher.Data));
+            dispatchers.pop();
+        }
+
+        // Return processed buffers to the pool for reuse by Dispatch
+        m_callbackBufferPool.Release(buffers);
+    }
+}
+
+void DataPublisher::RunBoundedCallbackThread()
+{
+    const SharedPtr<RingBuffer<CallbackDispatcher>> callbackQueue = m_boundedCallbackQueue;
+    vector<CallbackDispatcher> dispatchers;
+    vector<BufferPtr> buffers;
+
+    dispatchers.reserve(callbackQueue->Capacity());
+
+    while (true)
+    {
+        callbackQueue->WaitForData();
+
+        if (m_disposing)
+            break;
+
+        callbackQueue->TryDequeueBulk(dispatchers, callbackQueue->Capacity());
+
+        for (CallbackDispatcher& dispatcher : dispatchers)
+        {
+            if (m_disposing)
+                break;
+
+            dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+            buffers.push_back(std::move(dispatcher.Data));
+        }
+
+        dispatchers.clear();
+        m_callbackBufferPool.Release(buffers);
     }
 }
 
 void DataPublisher::RunCommandChannelAcceptThread()
 {
+    // Accepted connections hold a reference to the publisher, which only exists once
+    // the constructor, started on another thread, has returned into a shared pointer
+    while (weak_from_this().expired())
+    {
+        if (m_disposing)
+            return;
+
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+    }
+
     StartAccept();
     m_commandChannelService.run();
 }
 
+// Command and data channel I/O of the subscriber connections assigned to the context is completed on this thread
+void DataPublisher::RunConnectionServiceThread(size_t index)
+{
+    m_connectionServices[index]->run();
+}
+
 void DataPublisher::StartAccept()
 {
-    const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(shared_from_this(), m_commandChannelService, m_dataChannelService);
+    // Only the accept thread assigns connection services
+    IOContext& connectionService = *m_connectionServices[m_nextConnectionService];
+    m_nextConnectionService = (m_nextConnectionService + 1) % m_connectionServices.size();
+
+    const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(shared_from_this(), connectionService, connectionService);
     m_clientAcceptor.async_accept(connection->CommandChannelSocket(), boost::bind(&DataPublisher::AcceptConnection, this, connection, asio::placeholders::error));
 }
 
@@ -146,7 +293,14 @@ void DataPublisher::RemoveConnection(const SubscriberConnectionPtr& connection)
     m_subscriberConnectionsLock.lock();
 
     if (m_subscriberConnections.erase(connection))
+    {
+        // Release the publication group reference so the removed connection is not kept alive
+        for (auto& group : m_publicationGroups)
+            group.erase(remove(group.begin(), group.end(), connection), group.end());
+
+        m_publicationGroupsChanged = true;
         DispatchClientDisconnected(connection->GetSubscriberID(), connection->GetConnectionID());
+    }
 
     m_subscriberConnectionsLock.unlock();
 }
@@ -225,7 +379,7 @@ bool DataPublisher::ParseSubscriptionRequest(const SubscriberConnectionPtr& conn
     for (size_t i = 0; i < rows.size(); i++)
     {
         const DataRowPtr& row = rows[i];
-        const Guid& signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();        
+        const Guid signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();        
         string source;
         uint32_t id;
 
@@ -236,6 +390,165 @@ bool DataPublisher::ParseSubscriptionRequest(const SubscriberConnectionPtr& conn
     return true;
 }
 
+// Replaces the given signal index cache with the cache of another connection when both map exactly
+// the same signals, so that connections with the same subscription can share serialized data packets.
+void DataPublisher::ShareSignalIndexCache(SignalIndexCachePtr& signalIndexCache)
+{
+    ScopeLock lock(m_subscriberConnectionsLock);
+
+    for (const auto& connection : m_subscriberConnections)
+    {
+        const SignalIndexCachePtr& connectionSignalIndexCache = connection->GetSignalIndexCache();
+
+        if (connectionSignalIndexCache != nullptr && connectionSignalIndexCache != signalIndexCache && connectionSignalIndexCache->Equals(*signalIndexCache))
+        {
+            signalIndexCache = connectionSignalIndexCache;
+            return;
+        }
+    }
+}
+
+// Groups subscribed connections that serialize measurements to identical data packets into
+// m_publicationGroups. Connections that cannot share data packets, e.g., those using TSSC,
+// are each placed in their own group. Groups are left as they are unless a change in the
+// publication settings has been flagged. Expects m_subscriberConnectionsLock to be held.
+void DataPublisher::GroupSubscriberConnections()
+{
+    if (!m_publicationGroupsChanged)
+        return;
+
+    m_publicationGroupsChanged = false;
+
+    size_t groupCount = 0;
+
+    for (auto& group : m_publicationGroups)
+        group.clear();
+
+    for (const auto& connection : m_subscriberConnections)
+    {
+        if (!connection->GetIsSubscribed())
+            continue;
+
+        size_t groupIndex = groupCount;
+
+        if (connection->CanSharePublication())
+        {
+            for (size_t i = 0; i < groupCount; i++)
+            {
+                const SubscriberConnectionPtr& groupConnection = m_publicationGroups[i][0];
+
+                if (groupConnection->CanSharePublication() && groupConnection->IsPublicationEquivalent(*connection))
+                {
+                    groupIndex = i;
+                    break;
+                }
+            }
+        }
+
+        if (groupIndex == groupCount)
+        {
+            if (groupCount == m_publicationGroups.size())
+                m_publicationGroups.emplace_back();
+
+            groupCount++;
+        }
+
+        m_publicationGroups[groupIndex].push_back(connection);
+    }
+}
+
+// Defines the initial base time offsets from the first published timestamp, the second offset
+// is where timestamps will be compacted from after the first rotation. Expects
+// m_subscriberConnectionsLock to be held.
+void DataPublisher::InitializeBaseTimes(int64_t timestamp)
+{
+    m_timeIndex = 0;
+    m_baseTimeOffsets[0] = timestamp;
+    m_baseTimeOffsets[1] = timestamp + BaseTimeRotationInterval * Ticks::PerMillisecond;
+    m_latestTimestamp = timestamp;
+
+    for (const auto& connection : m_subscriberConnections)
+    {
+        if (connection->GetIsSubscribed())
+            connection->UpdateBaseTimes(m_timeIndex, m_baseTimeOffsets);
+    }
+
+    m_publicationGroupsChanged = true;
+    m_baseTimeRotationTimer.Start();
+}
+
+// Tracks real time as the latest published timestamp, base time offsets are initialized
+// on first publication. Expects m_subscriberConnectionsLock to be held.
+void DataPublisher::UpdateLatestTimestamp(int64_t timestamp)
+{
+    if (timestamp <= 0L)
+        return;
+
+    if (m_baseTimeOffsets[0] == 0L)
+        InitializeBaseTimes(timestamp);
+    else if (timestamp > m_latestTimestamp)
+        m_latestTimestamp = timestamp;
+}
+
+// Switches subscriptions to the other base time offset, which subscribers have already received,
+// and moves the old offset one rotation interval past real time. Compact measurement timestamps
+// are serialized as 2-byte millisecond or 4-byte tick offsets from the active base time, so the
+// rotation interval is kept within the range of a 2-byte millisecond offset.
+void DataPublisher::RotateBaseTimes()
+{
+    ScopeLock lock(m_subscriberConnectionsLock);
+
+    if (m_baseTimeOffsets[0] == 0L)
+        return;
+
+    const int32_t oldIndex = m_timeIndex;
+
+    m_timeIndex ^= 1;
+    m_baseTimeOffsets[oldIndex] = m_latestTimestamp + BaseTimeRotationInterval * Ticks::PerMillisecond;
+
+    for (const auto& connection : m_subscriberConnections)
+    {
+        if (connection->GetIsSubscribed())
+            connection->UpdateBaseTimes(m_timeIndex, m_baseTimeOffsets);
+    }
+
+    m_publicationGroupsChanged = true;
+}
+
+void DataPublisher::BaseTimeRotationTimerElapsed(Timer* timer, void* userData)
+{
+    DataPublisher* publisher = static_cast<DataPublisher*>(userData);
+
+    if (publisher == nullptr || publisher->m_disposing)
+        return;
+
+    publisher->RotateBaseTimes();
+}
+
+// Rotates the cipher keys of all connections that encrypt data packets on the data channel
+void DataPublisher::RotateCipherKeys()
+{
+    ScopeLock lock(m_subscriberConnectionsLock);
+
+    for (const auto& connection : m_subscriberConnections)
+    {
+        if (connection->CipherKeysDefined())
+            connection->RotateCipherKeys();
+    }
+
+    m_publicationGroupsChanged = true;
+}
+
+void DataPublisher::CipherKeyRotationTimerElapsed(Timer* timer, void* userData)
+{
+    DataPublisher* publisher = static_cast<DataPublisher*>(userData);
+
+    if (publisher == nullptr || publisher->m_disposing)
+        return;
+
+    publisher->RotateCipherKeys();
+}
+
 void DataPublisher::HandleSubscribe(const SubscriberConnectionPtr& connection, uint8_t* data, uint32_t length)
 {
     try
@@ -245,123 +558,206 @@ void DataPublisher::HandleSubscribe(const SubscriberConnectionPtr& connection, u
             const uint8_t flags = data[0];
             int32_t index = 1;
 
-            if ((flags & DataPacketFlags::Synchronized) > 0)
-            {
-                // Remotely synchronized subscriptions are currently disallowed by data publisher
-                const string message = "Client request for remotely synchronized data subscription was denied. Data publisher currently does not allow for synchronized subscriptions.";
-                SendClientResponse(connection, ServerResponse::Failed, ServerCommand::Subscribe, message);
-                DispatchErrorMessage(message);
-            }
-            else
-            {
-                // Next 4 bytes are an integer representing the length of the connection string that follows
-                const uint32_t byteLength = EndianConverter::ToBigEndian<uint32_t>(data, index);
-                index += 4;
+            // Next 4 bytes are an integer representing the length of the connection string that follows
+            const uint32_t byteLength = EndianConverter::ToBigEndian<uint32_t>(data, index);
+            index += 4;
 
-                if (byteLength > 0 && length >= byteLength + 6U)
+            if (byteLength > 0 && length >= byteLength + 6U)
+            {
+                const bool usePayloadCompression = (connection->GetOperationalModes() & OperationalModes::CompressPayloadData) > 0;
+                const bool useCompactMeasurementFormat = (flags & DataPacketFlags::Compact) > 0;
+                const bool synchronized = (flags & DataPacketFlags::Synchronized) > 0;
+                const string connectionString = DecodeClientString(connection, data, index, byteLength);
+                const StringMap<string> settings = ParseKeyValuePairs(connectionString);
+                string setting;
+
+                // A resubscribing connection is taken out of publication before its settings
+                // change so cached publication groups never serialize with mixed settings
+                m_subscriberConnectionsLock.lock();
+
+                if (connection->GetIsSubscribed())
                 {
-                    const bool usePayloadCompression = (connection->GetOperationalModes() & OperationalModes::CompressPayloadData) > 0;
-                    const bool useCompactMeasurementFormat = (flags & DataPacketFlags::Compact) > 0;
-                    const string connectionString = DecodeClientString(connection, data, index, byteLength);
-                    const StringMap<string> settings = ParseKeyValuePairs(connectionString);
-                    string setting;
+                    connection->SetIsSubscribed(false);
+                    m_publicationGroupsChanged = true;
+                }
 
-                    if (TryGetValue(settings, "includeTime", setting))
-                        connection->SetIncludeTime(ParseBoolean(setting));
+                m_subscriberConnectionsLock.unlock();
 
-                    if (TryGetValue(settings, "useMillisecondResolution", setting))
-                        connection->SetUseMillisecondResolution(ParseBoolean(setting));
+                if (TryGetValue(settings, "includeTime", setting))
+                    connection->SetIncludeTime(ParseBoolean(setting));
 
-                    if (TryGetValue(settings, "requestNaNValueFilter", setting))
-                        connection->SetIsNaNFiltered(ParseBoolean(setting));
+                if (TryGetValue(settings, "useMillisecondResolution", setting))
+                    connection->SetUseMillisecondResolution(ParseBoolean(setting));
 
-                    connection->SetUsePayloadCompression(usePayloadCompression);
-                    connection->SetUseCompactMeasurementFormat(useCompactMeasurementFormat);
-                    
-                    SignalIndexCachePtr signalIndexCache = nullptr;
+                // NaN values are filtered when requested and allowed, or when forced by the publisher
+                bool isNaNFiltered = false;
 
-                    // Apply subscriber filter expression and build signal index cache
-                    if (TryGetValue(settings, "inputMeasurementKeys", setting))
-                    {
-                        if (!ParseSubscriptionRequest(connection, setting, signalIndexCache))
-                            return;
-                    }
+                if (m_allowNaNValueFilter && TryGetValue(settings, "requestNaNValueFilter", setting))
+                    isNaNFiltered = ParseBoolean(setting);
 
-                    // Pass subscriber assembly information to connection, if defined
-                    if (TryGetValue(settings, "assemblyInfo", setting))
-                    {
-                        connection->SetSubscriptionInfo(setting);
-                        DispatchStatusMessage("Reported client subscription info: " + connection->GetSubscriptionInfo());
-                    }
+                connection->SetIsNaNFiltered(isNaNFiltered || m_forceNaNValueFilter);
+
+                connection->SetUsePayloadCompression(usePayloadCompression);
+                connection->SetUseCompactMeasurementFormat(useCompactMeasurementFormat);
+                
+                SignalIndexCachePtr signalIndexCache = nullptr;
+                bool defineCipherKeys = false;
 
-                    // TODO: Set up UDP data channel if client has requested this
-                    if (TryGetValue(settings, "dataChannel", setting))
+                // Apply subscriber filter expression and build signal index cache
+                if (TryGetValue(settings, "inputMeasurementKeys", setting))
+                {
+                    if (!ParseSubscriptionRequest(connection, setting, signalIndexCache))
+                        return;
+                }
+
+                // Pass subscriber assembly information to connection, if defined
+                if (TryGetValue(settings, "assemblyInfo", setting))
+                {
+                    connection->SetSubscriptionInfo(setting);
+                    DispatchStatusMessage("Reported client subscription info: " + connection->GetSubscriptionInfo());
+                }
+
+                // Set up UDP data channel if client has requested this
+                if (TryGetValue(settings, "dataChannel", setting))
+                {
+                    const StringMap<string> dataChannelSettings = ParseKeyValuePairs(setting);
+
+                    if (TryGetValue(dataChannelSettings, "port", setting) || TryGetValue(dataChannelSettings, "localport", setting))
                     {
-                    /*
-                        Socket clientSocket = connection.GetCommandChannelSocket();
-                        Dictionary<string, string> settings = setting.ParseKeyValuePairs();
-                        IPEndPoint localEndPoint = null;
-                        string networkInterface = "::0";
+                        // Port must be a whole number within the range of UDP ports, out of range values are
+                        // not truncated to some other port
+                        const string portSetting = Trim(setting);
+                        const bool isNumeric = !portSetting.empty() && portSetting.size() <= 5 && all_of(portSetting.begin(), portSetting.end(), [](const char value) { return isdigit(static_cast<uint8_t>(value)) != 0; });
+                        const uint32_t port = isNumeric ? static_cast<uint32_t>(stoul(portSetting)) : 0U;
+
+                        if (port < 1U || port > 65535U)
+                        {
+                            const string message = "Cannot open UDP data channel for client subscription: \"" + setting + "\" is not a valid port number, expected a value from 1 to 65535.";
+                            SendClientResponse(connection, ServerResponse::Failed, ServerCommand::Subscribe, message);
+                            DispatchErrorMessage(message);
+                            return;
+                        }
 
-                        // Make sure return interface matches incoming client connection
-                        if ((object)clientSocket != null)
-                            localEndPoint = clientSocket.LocalEndPoint as IPEndPoint;
+                        const uint32_t operationalModes = connection->GetOperationalModes();
 
-                        if ((object)localEndPoint != null)
+                        if ((operationalModes & CompressionModes::TSSC) > 0)
                         {
-                            networkInterface = localEndPoint.Address.ToString();
+                            // TSSC is a stateful compression algorithm which will not reliably support UDP
+                            DispatchStatusMessage("Cannot use TSSC compression mode with UDP - special compression mode disabled");
 
-                            // Remove dual-stack prefix
-                            if (networkInterface.StartsWith("::ffff:", true, CultureInfo.InvariantCulture))
-                                networkInterface = networkInterface.Substring(7);
+                            // Disable TSSC compression processing
+                            connection->SetOperationalModes(operationalModes & ~CompressionModes::TSSC);
+                            connection->SetUsePayloadCompression(false);
                         }
 
-                        if (settings.TryGetValue("port", out setting) || settings.TryGetValue("localport", out setting))
+                        ErrorCode error;
+                        connection->OpenDataChannel(static_cast<uint16_t>(port), error);
+
+                        if (error)
                         {
-                            if ((compressionModes & CompressionModes.TSSC) > 0)
-                            {
-                                // TSSC is a stateful compression algorithm which will not reliably support UDP
-                                OnStatusMessage(MessageLevel.Warning, "Cannot use TSSC compression mode with UDP - special compression mode disabled");
-
-                                // Disable TSSC compression processing
-                                compressionModes &= ~CompressionModes.TSSC;
-                                connection.OperationalModes &= ~OperationalModes.CompressionModeMask;
-                                connection.OperationalModes |= (OperationalModes)compressionModes;
-                            }
-
-                            connection.DataChannel = new UdpServer($"Port=-1; Clients={connection.IPAddress}:{int.Parse(setting)}; interface={networkInterface}");
-                            connection.DataChannel.Start();
+                            const string message = "Cannot open UDP data channel to port " + ToString(port) + " for client subscription: " + SystemError(error).what();
+                            SendClientResponse(connection, ServerResponse::Failed, ServerCommand::Subscribe, message);
+                            DispatchErrorMessage(message);
+                            return;
                         }
-                    */
+
+                        // Security mode only covers the command channel, so data packets sent on the
+                        // data channel are encrypted with keys sent over the command channel. Keys are
+                        // sent with each subscription since the subscriber resets them on subscribe.
+                        defineCipherKeys = m_securityMode != SecurityMode::None;
                     }
+                }
+                else
+                {
+                    ErrorCode error;
+                    connection->OpenDataChannel(0, error);
+                }
 
-                    int32_t signalCount = 0;
+                int32_t signalCount = 0;
 
-                    if (signalIndexCache != nullptr)
-                    {
-                        signalCount = signalIndexCache->Count();
+                if (signalIndexCache != nullptr)
+                {
+                    ShareSignalIndexCache(signalIndexCache);
+                    signalCount = signalIndexCache->Count();
 
-                        // Send updated signal index cache to client with validated rights of the selected input measurement keys                        
-                        SendClientResponse(connection, ServerResponse::UpdateSignalIndexCache, ServerCommand::Subscribe, SerializeSignalIndexCache(connection, signalIndexCache));
-                    }
+                    // Send updated signal index cache to client with validated rights of the selected input measurement keys                        
+                    SendClientResponse(connection, ServerResponse::UpdateSignalIndexCache, ServerCommand::Subscribe, SerializeSignalIndexCache(connection, signalIndexCache));
+                }
+
+                connection->SetSignalIndexCache(signalIndexCache);
+
+                FrameConcentratorPtr frameConcentrator = nullptr;
+                bool trackLatestMeasurements = false;
 
-                    connection->SetSignalIndexCache(signalIndexCache);
+                // Remotely synchronized subscriptions are concentrated into frames of time-aligned data
+                if (synchronized)
+                {
+                    float64_t framesPerSecond = 30.0;
+                    float64_t lagTime = 10.0;
+                    float64_t leadTime = 5.0;
+                    bool useLocalClockAsRealTime = false;
+
+                    if (TryGetValue(settings, "framesPerSecond", setting))
+                        TryParseDouble(setting, framesPerSecond);
+
+                    if (TryGetValue(settings, "lagTime", setting))
+                        TryParseDouble(setting, lagTime);
 
-                    const string message = "Client subscribed as " + string(useCompactMeasurementFormat ? "" : "non-") + "compact unsynchronized with " + ToString(signalCount) + " signals.";
+                    if (TryGetValue(settings, "leadTime", setting))
+                        TryParseDouble(setting, leadTime);
 
-                    connection->SetIsSubscribed(true);
-                    SendClientResponse(connection, ServerResponse::Succeeded, ServerCommand::Subscribe, message);
-                    DispatchStatusMessage(message);
+                    if (TryGetValue(settings, "useLocalClockAsRealTime", setting))
+                        useLocalClockAsRealTime = ParseBoolean(setting);
+
+                    frameConcentrator = NewSharedPtr<FrameConcentrator, uint32_t, float64_t, float64_t, bool>(static_cast<uint32_t>(framesPerSecond), lagTime, leadTime, useLocalClockAsRealTime);
                 }
-                else
+                else if (TryGetValue(settings, "trackLatestMeasurements", setting) && ParseBoolean(setting))
                 {
-                    const string message = byteLength > 0 ?
-                        "Not enough buffer was provided to parse client data subscription." :
-                        "Cannot initialize client data subscription without a connection string.";
+                    // Throttled subscriptions publish the latest measurement of each signal on the processing interval
+                    float64_t lagTime = 10.0;
+                    float64_t processingInterval = -1.0;
 
-                    SendClientResponse(connection, ServerResponse::Failed, ServerCommand::Subscribe, message);
-                    DispatchErrorMessage(message);
-                }            
+                    if (TryGetValue(settings, "lagTime", setting))
+                        TryParseDouble(setting, lagTime);
+
+                    if (TryGetValue(settings, "processingInterval", setting))
+                        TryParseDouble(setting, processingInterval);
+
+                    connection->SetLagTime(lagTime);
+                    connection->SetProcessingInterval(static_cast<int32_t>(processingInterval));
+                    trackLatestMeasurements = true;
+                }
+
+                const string message = "Client subscribed as " + string(useCompactMeasurementFormat ? "" : "non-") + "compact " + string(synchronized ? "" : "un") + "synchronized" + string(trackLatestMeasurements ? " throttled" : "") + " with " + ToString(signalCount) + " signals.";
+
+                m_subscriberConnectionsLock.lock();
+
+                // Cipher keys are installed while publication is blocked, so that the connection leaves any
+                // shared publication group, see CanSharePublication, before it receives encrypted data packets
+                if (defineCipherKeys)
+                    connection->RotateCipherKeys();
+
+                // Current base time offsets must reach the client before any data packets that use them
+                if (m_baseTimeOffsets[0] != 0L)
+                    connection->UpdateBaseTimes(m_timeIndex, m_baseTimeOffsets);
+
+                connection->SetFrameConcentrator(frameConcentrator);
+                connection->SetTrackLatestMeasurements(trackLatestMeasurements);
+                connection->SetIsSubscribed(true);
+                m_publicationGroupsChanged = true;
+                m_subscriberConnectionsLock.unlock();
+
+                SendClientResponse(connection, ServerResponse::Succeeded, ServerCommand::Subscribe, message);
+                DispatchStatusMessage(message);
+            }
+            else
+            {
+                const string message = byteLength > 0 ?
+                    "Not enough buffer was provided to parse client data subscription." :
+                    "Cannot initialize client data subscription without a connection string.";
+
+                SendClientResponse(connection, ServerResponse::Failed, ServerCommand::Subscribe, message);
+                DispatchErrorMessage(message);
             }            
         }
         else
@@ -381,7 +777,9 @@ void DataPublisher::HandleSubscribe(const SubscriberConnectionPtr& connection, u
 
 void DataPublisher::HandleUnsubscribe(const SubscriberConnectionPtr& connection)
 {
+    ScopeLock lock(m_subscriberConnectionsLock);
     connection->SetIsSubscribed(false);
+    m_publicationGroupsChanged = true;
 }
 
 void DataPublisher::HandleMetadataRefresh(const SubscriberConnectionPtr& connection, uint8_t* data, uint32_t length)
@@ -454,10 +852,35 @@ void DataPublisher::HandleMetadataRefresh(const SubscriberConnectionPtr& connect
 
 void DataPublisher::HandleRotateCipherKeys(const SubscriberConnectionPtr& connection)
 {
+    if (connection->CipherKeysDefined())
+    {
+        m_subscriberConnectionsLock.lock();
+        connection->RotateCipherKeys();
+        m_publicationGroupsChanged = true;
+        m_subscriberConnectionsLock.unlock();
+
+        DispatchStatusMessage("Cipher keys for client \"" + connection->GetConnectionID() + "\" were rotated on request.");
+    }
+    else
+    {
+        const string message = "Cipher key rotation request denied: client \"" + connection->GetConnectionID() + "\" is not using encrypted data channel.";
+        SendClientResponse(connection, ServerResponse::Failed, ServerCommand::RotateCipherKeys, message);
+        DispatchErrorMessage(message);
+    }
 }
 
 void DataPublisher::HandleUpdateProcessingInterval(const SubscriberConnectionPtr& connection, uint8_t* data, uint32_t length)
 {
+    if (length < 4)
+        return;
+
+    const int32_t processingInterval = EndianConverter::Default.ToBigEndian<int32_t>(data, 0);
+
+    connection->SetProcessingInterval(processingInterval);
+
+    const string message = "Processing interval for client \"" + connection->GetConnectionID() + "\" was set to " + (processingInterval > 0 ? ToString(processingInterval) + " milliseconds" : "its default") + ".";
+    SendClientResponse(connection, ServerResponse::Succeeded, ServerCommand::UpdateProcessingInterval, message);
+    DispatchStatusMessage(message);
 }
 
 void DataPublisher::HandleDefineOperationalModes(const SubscriberConnectionPtr& connection, uint8_t* data, uint32_t length)
@@ -497,21 +920,19 @@ void DataPublisher::Dispatch(const DispatcherFunction& function)
 void DataPublisher::Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length)
 {
     CallbackDispatcher dispatcher;
-    SharedPtr<vector<uint8_t>> dataVector = NewSharedPtr<vector<uint8_t>>();
+    const BufferPtr dataVector = m_callbackBufferPool.Acquire(length);
 
-    dataVector->resize(length);
-
-    if (data != nullptr)
-    {
-        for (uint32_t i = 0; i < length; ++i)
-            dataVector->at(i) = data[offset + i];
-    }
+    if (data != nullptr && length > 0)
+        memcpy(dataVector->data(), data + offset, length);
 
     dispatcher.Source = this;
     dispatcher.Data = dataVector;
     dispatcher.Function = function;
 
-    m_callbackQueue.Enqueue(dispatcher);
+    if (m_boundedCallbackQueue != nullptr)
+        m_boundedCallbackQueue->Enqueue(std::move(dispatcher));
+    else
+        m_callbackQueue.Enqueue(std::move(dispatcher));
 }
 
 void DataPublisher::DispatchStatusMessage(const string& message)
@@ -706,105 +1127,86 @@ bool DataPublisher::SendClientResponse(const SubscriberConnectionPtr& connection
     return SendClientResponse(connection, responseCode, commandCode, EncodeClientString(connection, message));
 }
 
-bool DataPublisher::SendClientResponse(const SubscriberConnectionPtr& connection, uint8_t responseCode, uint8_t commandCode, const std::vector<uint8_t>& data)
+void DataPublisher::WriteClientResponseHeader(uint8_t responseCode, uint8_t commandCode, vector<uint8_t>& response)
 {
-    bool success = false;
+    const uint32_t dataLength = static_cast<uint32_t>(response.size()) - ClientResponseHeaderSize;
+    uint8_t* header = response.data();
 
-    try
-    {
-        const bool dataPacketResponse = responseCode == ServerResponse::DataPacket;
-        const bool useDataChannel = dataPacketResponse || responseCode == ServerResponse::BufferBlock;
-        const uint32_t packetSize = data.size() + 6;
-        vector<uint8_t> buffer {};
+    // Add command payload alignment header (deprecated)
+    header[0] = 0xAA;
+    header[1] = 0xBB;
+    header[2] = 0xCC;
+    header[3] = 0xDD;
 
-        buffer.reserve(Common::PayloadHeaderSize + packetSize);
+    EndianConverter::WriteLittleEndianBytes(header + 4, dataLength + Common::ResponseHeaderSize);
 
-        // Add command payload alignment header (deprecated)
-        buffer.push_back(0xAA);
-        buffer.push_back(0xBB);
-        buffer.push_back(0xCC);
-        buffer.push_back(0xDD);
+    // Add response code
+    header[8] = responseCode;
 
-        EndianConverter::WriteLittleEndianBytes(buffer, packetSize);
+    // Add original in response to command code
+    header[9] = commandCode;
 
-        // Add response code
-        buffer.push_back(responseCode);
+    // Add size of data buffer to response packet
+    EndianConverter::WriteBigEndianBytes(header + 10, static_cast<int32_t>(dataLength));
+}
 
-        // Add original in response to command code
-        buffer.push_back(commandCode);
+bool DataPublisher::SendClientResponse(const SubscriberConnectionPtr& connection, uint8_t responseCode, const BufferPtr& response)
+{
+    bool success = false;
 
-        if (data.empty())
+    try
+    {
+        const bool useDataChannel = responseCode == ServerResponse::DataPacket || responseCode == ServerResponse::BufferBlock;
+
+        // Data packets and buffer blocks are published on the UDP data channel when the client
+        // has requested one, since datagrams are self-delimiting the payload header is not sent
+        if (useDataChannel && connection->DataChannelDefined())
         {
-            // Add zero sized data buffer to response packet
-            WriteBytes(buffer, uint32_t(0));
+            BufferPtr packet = response;
+
+            // Response may be shared with other connections or still pending in an earlier send,
+            // so data packets are encrypted into a pooled buffer of the connection
+            if (responseCode == ServerResponse::DataPacket && connection->CipherKeysDefined())
+            {
+                packet = connection->EncryptDataPacket(*response);
+                WriteClientResponseHeader(responseCode, (*packet)[9], *packet);
+            }
+
+            const uint32_t responseLength = static_cast<uint32_t>(packet->size());
+            connection->DataChannelSendAsync(packet, Common::PayloadHeaderSize, responseLength - Common::PayloadHeaderSize, packet != response);
+            m_totalDataChannelBytesSent += responseLength - Common::PayloadHeaderSize;
         }
         else
         {
-            if (dataPacketResponse && connection->CipherKeysDefined())
-            {
-                // TODO: Implement UDP AES data packet encryption
-                //// Get a local copy of volatile keyIVs and cipher index since these can change at any time
-                //byte[][][] keyIVs = connection.KeyIVs;
-                //int cipherIndex = connection.CipherIndex;
-
-                //// Reserve space for size of data buffer to go into response packet
-                //workingBuffer.Write(ZeroLengthBytes, 0, 4);
-
-                //// Get data packet flags
-                //DataPacketFlags flags = (DataPacketFlags)data[0];
-
-                //// Encode current cipher index into data packet flags
-                //if (cipherIndex > 0)
-                //    flags |= DataPacketFlags.CipherIndex;
-
-                //// Write data packet flags into response packet
-                //workingBuffer.WriteByte((byte)flags);
-
-                //// Copy source data payload into a memory stream
-                //MemoryStream sourceData = new MemoryStream(data, 1, data.Length - 1);
-
-                //// Encrypt payload portion of data packet and copy into the response packet
-                //Common.SymmetricAlgorithm.Encrypt(sourceData, workingBuffer, keyIVs[cipherIndex][0], keyIVs[cipherIndex][1]);
-
-                //// Calculate length of encrypted data payload
-                //int payloadLength = (int)workingBuffer.Length - 6;
+            const uint32_t responseLength = static_cast<uint32_t>(response->size());
+            connection->CommandChannelSendAsync(response, 0, responseLength, responseCode == ServerResponse::DataPacket);
+            m_totalCommandChannelBytesSent += responseLength;
+        }
 
-                //// Move the response packet position back to the packet size reservation
-                //workingBuffer.Seek(2, SeekOrigin.Begin);
+        success = true;
+    }
+    catch (const std::exception& ex)
+    {
+        DispatchErrorMessage(ex.what());
+    }
 
-                //// Add the actual size of payload length to response packet
-                //workingBuffer.Write(BigEndian.GetBytes(payloadLength), 0, 4);
-            }
-            else
-            {
-                // Add size of data buffer to response packet
-                EndianConverter::WriteBigEndianBytes(buffer, static_cast<int32_t>(data.size()));
+    return success;
+}
 
-                // Write data buffer
-                WriteBytes(buffer, data);
-            }
+bool DataPublisher::SendClientResponse(const SubscriberConnectionPtr& connection, uint8_t responseCode, uint8_t commandCode, const std::vector<uint8_t>& data)
+{
+    bool success = false;
 
-            // TODO: Publish packet on UDP
-            //// Data packets and buffer blocks can be published on a UDP data channel, so check for this...
-            //if (useDataChannel)
-            //    publishChannel = m_clientPublicationChannels.GetOrAdd(clientID, id => (object)connection != null ? connection.PublishChannel : m_commandChannel);
-            //else
-            //    publishChannel = m_commandChannel;
-
-            //// Send response packet
-            //if ((object)publishChannel != null && publishChannel.CurrentState == ServerState.Running)
-            //{
-            //    if (publishChannel is UdpServer)
-            //        publishChannel.MulticastAsync(buffer, 0, buffer.size());
-            //    else
-            //        publishChannel.SendToAsync(connection, buffer, 0, buffer.size());
-
-            //}
-
-            connection->CommandChannelSendAsync(buffer.data(), 0, buffer.size());
-            m_totalCommandChannelBytesSent += buffer.size();
-            success = true;
-        }
+    try
+    {
+        // Data is copied once, directly behind the headroom reserved for the response headers
+        const BufferPtr response = NewSharedPtr<vector<uint8_t>>();
+        response->reserve(ClientResponseHeaderSize + data.size());
+        response->resize(ClientResponseHeaderSize);
+        response->insert(response->end(), data.begin(), data.end());
+
+        WriteClientResponseHeader(responseCode, commandCode, *response);
+        success = SendClientResponse(connection, responseCode, response);
     }
     catch (const std::exception& ex)
     {
@@ -843,7 +1245,7 @@ void DataPublisher::DefineMetadata(const vector<DeviceMetadataPtr>& deviceMetada
         const int32_t framesPerSecond = GetColumnIndex(deviceDetail, "FramesPerSecond");
         const int32_t companyAcronym = GetColumnIndex(deviceDetail, "CompanyAcronym");
         const int32_t vendorAcronym = GetColumnIndex(deviceDetail, "VendorAcronym");
-        const int32_t vendorDeviceName = GetColumnIndex(deviceDetail, "VendorDeviceAcronym");
+        const int32_t vendorDeviceName = GetColumnIndex(deviceDetail, "VendorDeviceName");
         const int32_t longitude = GetColumnIndex(deviceDetail, "Longitude");
         const int32_t latitude = GetColumnIndex(deviceDetail, "Latitude");
         const int32_t enabled = GetColumnIndex(deviceDetail, "Enabled");
@@ -1120,6 +1522,12 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
         const int32_t am_description = GetColumnIndex(activeMeasurements, "Description");
         const int32_t am_updatedOn = GetColumnIndex(activeMeasurements, "UpdatedOn");
 
+        // Index columns commonly used to look up measurements in subscriber filter expressions
+        activeMeasurements->CreateIndex(am_signalID);
+        activeMeasurements->CreateIndex(am_id);
+        activeMeasurements->CreateIndex(am_pointTag);
+        activeMeasurements->CreateIndex(am_device);
+
         for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
         {
             const DataRowPtr& md_row = measurementDetail->Row(i);
@@ -1248,16 +1656,45 @@ vector<MeasurementMetadataPtr> DataPublisher::FilterMetadata(const string& filte
     return measurementMetadata;
 }
 
+// Measurements are serialized once for each group of connections that would receive identical
+// data packets, and the serialized packets are shared by the sends to every connection in the group.
+template<typename T>
+void DataPublisher::PublishMeasurementsImpl(const vector<T>& measurements, int64_t timestamp)
+{
+    ScopeLock lock(m_subscriberConnectionsLock);
+    UpdateLatestTimestamp(timestamp);
+    GroupSubscriberConnections();
+
+    for (const auto& group : m_publicationGroups)
+    {
+        if (group.empty())
+            continue;
+
+        if (group.size() == 1)
+        {
+            group[0]->PublishMeasurements(measurements);
+            continue;
+        }
+
+        group[0]->SerializeDataPackets(measurements, m_publicationResponses);
+
+        for (const auto& connection : group)
+            connection->PublishDataPackets(m_publicationResponses, timestamp);
+
+        m_publicationResponses.clear();
+    }
+}
+
 void DataPublisher::PublishMeasurements(const vector<Measurement>& measurements)
 {
-    for (const auto& connection : m_subscriberConnections)
-        connection->PublishMeasurements(measurements);
+    if (!measurements.empty())
+        PublishMeasurementsImpl(measurements, measurements[0].Timestamp);
 }
 
 void DataPublisher::PublishMeasurements(const vector<MeasurementPtr>& measurements)
 {
-    for (const auto& connection : m_subscriberConnections)
-        connection->PublishMeasurements(measurements);
+    if (!measurements.empty())
+        PublishMeasurementsImpl(measurements, measurements[0]->Timestamp);
 }
 
 const GSF::Guid& DataPublisher::GetNodeID() const
@@ -1321,6 +1758,52 @@ uint32_t DataPublisher::GetCipherKeyRotationPeriod() const
 void DataPublisher::SetCipherKeyRotationPeriod(uint32_t period)
 {
     m_cipherKeyRotationPeriod = period;
+
+    // A period of zero disables automatic key rotation
+    if (period == 0)
+    {
+        m_cipherKeyRotationTimer.Stop();
+    }
+    else
+    {
+        m_cipherKeyRotationTimer.SetInterval(static_cast<int32_t>(period));
+        m_cipherKeyRotationTimer.Start();
+    }
+}
+
+uint32_t DataPublisher::GetMaxSendQueueSize() const
+{
+    return m_maxSendQueueSize;
+}
+
+void DataPublisher::SetMaxSendQueueSize(uint32_t maxSendQueueSize)
+{
+    m_maxSendQueueSize = maxSendQueueSize;
+}
+
+SendQueueOverflowPolicy DataPublisher::GetSendQueueOverflowPolicy() const
+{
+    return m_sendQueueOverflowPolicy;
+}
+
+void DataPublisher::SetSendQueueOverflowPolicy(SendQueueOverflowPolicy overflowPolicy)
+{
+    m_sendQueueOverflowPolicy = overflowPolicy;
+}
+
+float64_t DataPublisher::GetMaxSendQueueLagTime() const
+{
+    return m_maxSendQueueLagTime;
+}
+
+void DataPublisher::SetMaxSendQueueLagTime(float64_t maxSendQueueLagTime)
+{
+    m_maxSendQueueLagTime = maxSendQueueLagTime;
+}
+
+uint32_t DataPublisher::GetConnectionThreadCount() const
+{
+    return static_cast<uint32_t>(m_connectionServices.size());
 }
 
 void* DataPublisher::GetUserData() const
@@ -1348,6 +1831,31 @@ uint64_t DataPublisher::GetTotalMeasurementsSent() const
     return m_totalMeasurementsSent;
 }
 
+uint64_t DataPublisher::GetTotalCallbacksDropped() const
+{
+    if (m_boundedCallbackQueue == nullptr)
+        return 0UL;
+
+    return m_boundedCallbackQueue->GetDroppedCount();
+}
+
+uint64_t DataPublisher::GetTotalDataPacketsDropped() const
+{
+    return m_totalDataPacketsDropped;
+}
+
+// Gets the largest send queue depth reached by any currently connected subscriber
+uint32_t DataPublisher::GetPeakSendQueueDepth()
+{
+    ScopeLock lock(m_subscriberConnectionsLock);
+    uint32_t peakSendQueueDepth = 0;
+
+    for (const auto& connection : m_subscriberConnections)
+        peakSendQueueDepth = max(peakSendQueueDepth, connection->GetPeakSendQueueDepth());
+
+    return peakSendQueueDepth;
+}
+
 bool DataPublisher::IsConnected() const
 {
     return m_connected;
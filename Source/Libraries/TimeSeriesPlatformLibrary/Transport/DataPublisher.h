@@ -26,11 +26,15 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/BufferPool.h"
+#include "../Common/RingBuffer.h"
+#include "../Common/Timer.h"
 #include "../Data/DataSet.h"
 #include "SubscriberConnection.h"
 #include "TransportTypes.h"
 #include "SignalIndexCache.h"
 #include "Constants.h"
+#include <atomic>
 
 namespace GSF {
 namespace FilterExpressions
@@ -56,7 +60,7 @@ namespace Transport
         struct CallbackDispatcher
         {
             DataPublisher* Source;
-            SharedPtr<std::vector<uint8_t>> Data;
+            BufferPtr Data;
             DispatcherFunction Function;
 
             CallbackDispatcher();
@@ -67,41 +71,82 @@ namespace Transport
         GSF::Data::DataSetPtr m_filteringMetadata;
         std::unordered_set<SubscriberConnectionPtr> m_subscriberConnections;
         GSF::Mutex m_subscriberConnectionsLock;
+
+        // Subscribed connections grouped by equivalent publication, see GroupSubscriberConnections.
+        // Reused between calls to PublishMeasurements, guarded by m_subscriberConnectionsLock.
+        // Groups are only rebuilt when m_publicationGroupsChanged is set, i.e., after a change
+        // to subscriptions, cipher keys or base time offsets.
+        std::vector<std::vector<SubscriberConnectionPtr>> m_publicationGroups;
+        std::vector<BufferPtr> m_publicationResponses;
+        bool m_publicationGroupsChanged;
+
+        // Base time offsets shared by all subscriptions for compact timestamps, see RotateBaseTimes.
+        // Guarded by m_subscriberConnectionsLock.
+        int64_t m_baseTimeOffsets[2];
+        int32_t m_timeIndex;
+        int64_t m_latestTimestamp;
+        GSF::Timer m_baseTimeRotationTimer;
         SecurityMode m_securityMode;
         bool m_allowMetadataRefresh;
         bool m_allowNaNValueFilter;
         bool m_forceNaNValueFilter;
         uint32_t m_cipherKeyRotationPeriod;
+        GSF::Timer m_cipherKeyRotationTimer;
+        uint32_t m_maxSendQueueSize;
+        SendQueueOverflowPolicy m_sendQueueOverflowPolicy;
+        float64_t m_maxSendQueueLagTime;
         void* m_userData;
         bool m_disposing;
 
         // Statistics counters
-        uint64_t m_totalCommandChannelBytesSent;
-        uint64_t m_totalDataChannelBytesSent;
-        uint64_t m_totalMeasurementsSent;
+        std::atomic<uint64_t> m_totalCommandChannelBytesSent;
+        std::atomic<uint64_t> m_totalDataChannelBytesSent;
+        std::atomic<uint64_t> m_totalMeasurementsSent;
+        std::atomic<uint64_t> m_totalDataPacketsDropped;
         bool m_connected;
 
         // Callback thread members
         Thread m_callbackThread;
         ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
+        SharedPtr<RingBuffer<CallbackDispatcher>> m_boundedCallbackQueue;
+        BufferPool m_callbackBufferPool;
 
         // Command channel
         Thread m_commandChannelAcceptThread;
         GSF::IOContext m_commandChannelService;
         GSF::TcpAcceptor m_clientAcceptor;
 
-        // Data channel
-        GSF::IOContext m_dataChannelService;
+        // Subscriber connection I/O, each context is run by its own thread and services both the
+        // command and data channels of the connections assigned to it, round-robin, on accept
+        typedef GSF::SharedPtr<GSF::IOContext> IOContextPtr;
+        typedef boost::asio::executor_work_guard<GSF::IOContext::executor_type> IOContextWork;
+        std::vector<IOContextPtr> m_connectionServices;
+        std::vector<IOContextWork> m_connectionServiceWork;
+        std::vector<Thread> m_connectionServiceThreads;
+        size_t m_nextConnectionService;
 
         // Threads
         void RunCallbackThread();
+        void RunBoundedCallbackThread();
         void RunCommandChannelAcceptThread();
+        void RunConnectionServiceThread(size_t index);
 
         // Command channel handlers
         void StartAccept();
         void AcceptConnection(const SubscriberConnectionPtr& connection, const ErrorCode& error);
         void RemoveConnection(const SubscriberConnectionPtr& connection);
         bool ParseSubscriptionRequest(const SubscriberConnectionPtr& connection, const std::string& filterExpression, SignalIndexCachePtr& signalIndexCache);
+        void ShareSignalIndexCache(SignalIndexCachePtr& signalIndexCache);
+        void GroupSubscriberConnections();
+
+        template<typename T>
+        void PublishMeasurementsImpl(const std::vector<T>& measurements, int64_t timestamp);
+        void InitializeBaseTimes(int64_t timestamp);
+        void UpdateLatestTimestamp(int64_t timestamp);
+        void RotateBaseTimes();
+        static void BaseTimeRotationTimerElapsed(GSF::Timer* timer, void* userData);
+        void RotateCipherKeys();
+        static void CipherKeyRotationTimerElapsed(GSF::Timer* timer, void* userData);
 
         // Callbacks
         MessageCallback m_statusMessageCallback;
@@ -140,10 +185,29 @@ namespace Transport
         std::vector<uint8_t> SerializeMetadata(const SubscriberConnectionPtr& connection, const GSF::Data::DataSetPtr& metadata) const;
         bool SendClientResponse(const SubscriberConnectionPtr& connection, uint8_t responseCode, uint8_t commandCode, const std::string& message);
         bool SendClientResponse(const SubscriberConnectionPtr& connection, uint8_t responseCode, uint8_t commandCode, const std::vector<uint8_t>& data = {});
+
+        // Size of the payload and response headers that precede the data of a client response.
+        static const uint32_t ClientResponseHeaderSize = Common::PayloadHeaderSize + 6;
+
+        // Writes the payload and response headers into the first ClientResponseHeaderSize bytes of
+        // a response, i.e., the headroom reserved in front of the data it carries. Responses framed
+        // this way carry no connection specific state, e.g., encryption, so the same response buffer
+        // can be sent to multiple connections.
+        static void WriteClientResponseHeader(uint8_t responseCode, uint8_t commandCode, std::vector<uint8_t>& response);
+
+        // Sends a complete response, starting with the headers above, that is shared rather than copied.
+        bool SendClientResponse(const SubscriberConnectionPtr& connection, uint8_t responseCode, const BufferPtr& response);
     public:
         // Creates a new instance of the data publisher.
-        DataPublisher(const GSF::TcpEndPoint& endpoint);
-        DataPublisher(uint16_t port, bool ipV6 = false);
+        //
+        // A non-zero callback queue capacity selects a bounded lock-free ring buffer for
+        // pending callbacks, using the given overflow policy when it is full, instead of
+        // the default unbounded queue.
+        //
+        // Subscriber connections are serviced by the given number of I/O threads, where
+        // zero selects one thread per available hardware thread.
+        DataPublisher(const GSF::TcpEndPoint& endpoint, uint32_t callbackQueueCapacity = 0, QueueOverflowPolicy callbackQueueOverflowPolicy = QueueOverflowPolicy::DropOldest, uint32_t connectionThreadCount = 0);
+        DataPublisher(uint16_t port, bool ipV6 = false, uint32_t callbackQueueCapacity = 0, QueueOverflowPolicy callbackQueueOverflowPolicy = QueueOverflowPolicy::DropOldest, uint32_t connectionThreadCount = 0);
 
         // Releases all threads and sockets
         // tied up by the publisher.
@@ -168,6 +232,8 @@ namespace Transport
         const GSF::Guid& GetNodeID() const;
         void SetNodeID(const GSF::Guid& nodeID);
 
+        // Gets or sets the security mode of the command channel. Unless the mode is None, data
+        // packets sent on a UDP data channel are encrypted with rotating AES cipher keys.
         SecurityMode GetSecurityMode() const;
         void SetSecurityMode(SecurityMode securityMode);
 
@@ -180,9 +246,28 @@ namespace Transport
         bool IsNaNValueFilterForced() const;
         void SetNaNValueFilterForced(bool forced);
 
+        // Gets or sets the period, in milliseconds, at which the cipher keys of encrypted
+        // data channels are rotated, zero disables automatic rotation.
         uint32_t GetCipherKeyRotationPeriod() const;
         void SetCipherKeyRotationPeriod(uint32_t period);
 
+        // Gets or sets the maximum number of responses queued for sending to each
+        // subscriber connection before the overflow policy applies, zero for no limit.
+        uint32_t GetMaxSendQueueSize() const;
+        void SetMaxSendQueueSize(uint32_t maxSendQueueSize);
+
+        // Gets or sets the action taken when a subscriber connection's send queue is full.
+        SendQueueOverflowPolicy GetSendQueueOverflowPolicy() const;
+        void SetSendQueueOverflowPolicy(SendQueueOverflowPolicy overflowPolicy);
+
+        // Gets or sets the maximum time, in seconds, a subscriber connection may take to receive
+        // a response before it is disconnected for falling behind, zero to never disconnect.
+        float64_t GetMaxSendQueueLagTime() const;
+        void SetMaxSendQueueLagTime(float64_t maxSendQueueLagTime);
+
+        // Gets the number of I/O threads servicing subscriber connections.
+        uint32_t GetConnectionThreadCount() const;
+
         // Gets or sets user defined data reference
         void* GetUserData() const;
         void SetUserData(void* userData);
@@ -191,6 +276,9 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesSent() const;
         uint64_t GetTotalDataChannelBytesSent() const;
         uint64_t GetTotalMeasurementsSent() const;
+        uint64_t GetTotalCallbacksDropped() const;
+        uint64_t GetTotalDataPacketsDropped() const;
+        uint32_t GetPeakSendQueueDepth();
         bool IsConnected() const;
 
         // Callback registration
@@ -240,8 +240,14 @@ DataSubscriber::DataSubscriber() :
     m_baseTimeOffsets { 0, 0 },
     m_tsscResetRequested(false),
     m_tsscSequenceNumber(0),
+    m_cipherKeysDefined(false),
+    m_callbackQueueCapacity(0),
+    m_callbackQueueOverflowPolicy(QueueOverflowPolicy::DropOldest),
     m_commandChannelSocket(m_commandChannelService),
-    m_readBuffer(Common::MaxPacketSize),
+    m_readBuffer(NewSharedPtr<vector<uint8_t>>(Common::MaxPacketSize)),
+    m_readBufferDispatched(false),
+    m_readOffset(0),
+    m_readLength(0),
     m_writeBuffer(Common::MaxPacketSize),
     m_dataChannelSocket(m_dataChannelService)
 {
@@ -256,13 +262,21 @@ DataSubscriber::~DataSubscriber()
 DataSubscriber::CallbackDispatcher::CallbackDispatcher() :
     Source(nullptr),
     Data(nullptr),
-    Function(nullptr)
+    Offset(0),
+    Length(0),
+    Function(nullptr),
+    ReleaseData(false)
 {
 }
 
 // All callbacks are run from the callback thread from here.
 void DataSubscriber::RunCallbackThread()
 {
+    // Pending callbacks are drained from the queue as a batch so that
+    // the queue lock is only acquired once per wake-up of this thread
+    queue<CallbackDispatcher> dispatchers;
+    vector<BufferPtr> buffers;
+
     while (true)
     {
         m_callbackQueue.WaitForData();
@@ -270,8 +284,58 @@ void DataSubscriber::RunCallbackThread()
         if (m_disconnecting)
             break;
 
-        const CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
-        dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+        m_callbackQueue.DequeueAll(dispatchers);
+
+        while (!dispatchers.empty() && !m_disconnecting)
+        {
+            CallbackDispatcher& dispatcher = dispatchers.front();
+
+            if (dispatcher.Function != nullptr)
+                dispatcher.Function(dispatcher.Source, dispatcher.Data->data() + dispatcher.Offset, dispatcher.Length);
+
+            if (dispatcher.ReleaseData)
+                buffers.push_back(std::move(dispatcher.Data));
+
+            dispatchers.pop();
+        }
+
+        // Return processed buffers to the pool for reuse by Dispatch
+        m_callbackBufferPool.Release(buffers);
+    }
+}
+
+// Callback thread used in place of the above when the bounded callback queue is selected.
+void DataSubscriber::RunBoundedCallbackThread()
+{
+    const SharedPtr<RingBuffer<CallbackDispatcher>> callbackQueue = m_boundedCallbackQueue;
+    vector<CallbackDispatcher> dispatchers;
+    vector<BufferPtr> buffers;
+
+    dispatchers.reserve(callbackQueue->Capacity());
+
+    while (true)
+    {
+        callbackQueue->WaitForData();
+
+        if (m_disconnecting)
+            break;
+
+        callbackQueue->TryDequeueBulk(dispatchers, callbackQueue->Capacity());
+
+        for (CallbackDispatcher& dispatcher : dispatchers)
+        {
+            if (m_disconnecting)
+                break;
+
+            if (dispatcher.Function != nullptr)
+                dispatcher.Function(dispatcher.Source, dispatcher.Data->data() + dispatcher.Offset, dispatcher.Length);
+
+            if (dispatcher.ReleaseData)
+                buffers.push_back(std::move(dispatcher.Data));
+        }
+
+        dispatchers.clear();
+        m_callbackBufferPool.Release(buffers);
     }
 }
 
@@ -279,53 +343,67 @@ void DataSubscriber::RunCallbackThread()
 // exception of data packets which may or may not be handled by this thread.
 void DataSubscriber::RunCommandChannelResponseThread()
 {
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, Common::PayloadHeaderSize), bind(&DataSubscriber::ReadPayloadHeader, this, _1, _2));
+    m_readOffset = 0;
+    m_readLength = 0;
+
+    ReadCommandChannel();
     m_commandChannelService.run();
 }
 
-// Callback for async read of the payload header.
-void DataSubscriber::ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred)
+// Starts an async read of as much data as the socket has available into the receive buffer.
+//
+// The receive buffer holds the unprocessed tail of the previous read between m_readOffset and
+// m_readLength. Once a response has been dispatched to the callback thread from the buffer, the
+// buffer is handed over to the callback thread, which returns it to the pool after handling every
+// response dispatched from it, and the unprocessed tail is moved to a fresh buffer from the pool.
+void DataSubscriber::ReadCommandChannel()
 {
     const uint32_t PacketSizeOffset = 4;
 
-    if (m_disconnecting)
-        return;
+    const uint32_t pendingLength = m_readLength - m_readOffset;
+    uint32_t requiredLength = Common::MaxPacketSize;
 
-    if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
+    // Make room for the whole of a partially received response
+    if (pendingLength >= Common::PayloadHeaderSize)
     {
-        // Connection closed by peer; terminate connection
-        Thread(bind(&DataSubscriber::ConnectionTerminatedDispatcher, this));
-        return;
+        const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_readBuffer->data(), m_readOffset + PacketSizeOffset);
+        requiredLength = max(requiredLength, Common::PayloadHeaderSize + packetSize);
     }
 
-    if (error)
+    if (m_readBufferDispatched)
     {
-        stringstream errorMessageStream;
+        // Replacement is sized for the pending response, so a buffer that once grew for a large
+        // response does not make every following replacement just as large
+        const BufferPtr readBuffer = m_callbackBufferPool.Acquire(requiredLength);
 
-        errorMessageStream << "Error reading data from command channel: ";
-        errorMessageStream << SystemError(error).what();
+        if (pendingLength > 0)
+            memcpy(readBuffer->data(), m_readBuffer->data() + m_readOffset, pendingLength);
 
-        DispatchErrorMessage(errorMessageStream.str());
-        return;
+        ReleaseDispatchedBuffer(m_readBuffer);
+        m_readBuffer = readBuffer;
+        m_readBufferDispatched = false;
     }
+    else
+    {
+        if (pendingLength > 0 && m_readOffset > 0)
+            memmove(m_readBuffer->data(), m_readBuffer->data() + m_readOffset, pendingLength);
 
-    // Gather statistics
-    m_totalCommandChannelBytesReceived += Common::PayloadHeaderSize;
-
-    const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_readBuffer.data(), PacketSizeOffset);
+        if (requiredLength > static_cast<uint32_t>(m_readBuffer->size()))
+            m_readBuffer->resize(requiredLength);
+    }
 
-    if (packetSize > static_cast<uint32_t>(m_readBuffer.size()))
-        m_readBuffer.resize(packetSize);
+    m_readOffset = 0;
+    m_readLength = pendingLength;
 
-    // Read packet (payload body)
-    // This read method is guaranteed not to return until the
-    // requested size has been read or an error has occurred.
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, packetSize), bind(&DataSubscriber::ReadPacket, this, _1, _2));
+    m_commandChannelSocket.async_read_some(buffer(m_readBuffer->data() + m_readLength, m_readBuffer->size() - m_readLength), bind(&DataSubscriber::ReadResponses, this, _1, _2));
 }
 
-// Callback for async read of packets.
-void DataSubscriber::ReadPacket(const ErrorCode& error, uint32_t bytesTransferred)
+// Callback for async read of the command channel. Processes every
+// complete response received and then starts the next read.
+void DataSubscriber::ReadResponses(const ErrorCode& error, uint32_t bytesTransferred)
 {
+    const uint32_t PacketSizeOffset = 4;
+
     if (m_disconnecting)
         return;
 
@@ -349,19 +427,33 @@ void DataSubscriber::ReadPacket(const ErrorCode& error, uint32_t bytesTransferre
 
     // Gather statistics
     m_totalCommandChannelBytesReceived += bytesTransferred;
+    m_readLength += bytesTransferred;
 
-    // Process response
-    ProcessServerResponse(&m_readBuffer[0], 0, bytesTransferred);
+    // A single read can contain any number of responses
+    while (m_readLength - m_readOffset >= Common::PayloadHeaderSize)
+    {
+        const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_readBuffer->data(), m_readOffset + PacketSizeOffset);
 
-    // Read next payload header
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, Common::PayloadHeaderSize), bind(&DataSubscriber::ReadPayloadHeader, this, _1, _2));
+        if (m_readLength - m_readOffset - Common::PayloadHeaderSize < packetSize)
+            break;
+
+        // Process response
+        if (ProcessServerResponse(m_readBuffer, m_readOffset + Common::PayloadHeaderSize, packetSize))
+            m_readBufferDispatched = true;
+        m_readOffset += Common::PayloadHeaderSize + packetSize;
+
+        if (m_disconnecting)
+            return;
+    }
+
+    ReadCommandChannel();
 }
 
 // If the user defines a separate UDP channel for their
 // subscription, data packets get handled from this thread.
 void DataSubscriber::RunDataChannelResponseThread()
 {
-    vector<uint8_t> buffer(Common::MaxPacketSize);
+    BufferPtr buffer = NewSharedPtr<vector<uint8_t>>(Common::MaxPacketSize);
     uint32_t length;
 
     udp::endpoint endpoint(m_hostAddress, 0);
@@ -370,7 +462,7 @@ void DataSubscriber::RunDataChannelResponseThread()
 
     while (true)
     {
-        length = m_dataChannelSocket.receive_from(asio::buffer(buffer), endpoint, 0, error);
+        length = m_dataChannelSocket.receive_from(asio::buffer(*buffer), endpoint, 0, error);
 
         if (m_disconnecting)
             break;
@@ -386,25 +478,36 @@ void DataSubscriber::RunDataChannelResponseThread()
         // Gather statistics
         m_totalDataChannelBytesReceived += length;
 
-        ProcessServerResponse(&buffer[0], 0, length);
+        // Do not overwrite a buffer handed over to the callback thread
+        if (ProcessServerResponse(buffer, 0, length))
+        {
+            ReleaseDispatchedBuffer(buffer);
+            buffer = m_callbackBufferPool.Acquire(Common::MaxPacketSize);
+        }
     }
 }
 
 // Processes a response sent by the server. Response codes are defined in the header file "Constants.h".
-void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uint32_t length)
+// Returns true when the response was dispatched to the callback thread as a slice of the given buffer,
+// in which case the buffer must not be written again and is to be handed over with ReleaseDispatchedBuffer.
+bool DataSubscriber::ProcessServerResponse(const BufferPtr& buffer, uint32_t offset, uint32_t length)
 {
     const uint32_t PacketHeaderSize = 6;
 
-    uint8_t* packetBodyStart = buffer + PacketHeaderSize;
+    uint8_t* packetStart = buffer->data() + offset;
+    uint8_t* packetBodyStart = packetStart + PacketHeaderSize;
+    const uint32_t packetBodyOffset = offset + PacketHeaderSize;
     const uint32_t packetBodyLength = length - PacketHeaderSize;
 
-    const uint8_t responseCode = buffer[0];
-    const uint8_t commandCode = buffer[1];
+    const uint8_t responseCode = packetStart[0];
+    const uint8_t commandCode = packetStart[1];
+    bool bufferDispatched = false;
 
     switch (responseCode)
     {
         case ServerResponse::Succeeded:
-            HandleSucceeded(commandCode, packetBodyStart, 0, packetBodyLength);
+            HandleSucceeded(commandCode, buffer, packetBodyOffset, packetBodyLength);
+            bufferDispatched = commandCode == ServerCommand::MetadataRefresh;
             break;
 
         case ServerResponse::Failed:
@@ -416,11 +519,13 @@ void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uin
             break;
 
         case ServerResponse::DataStartTime:
-            HandleDataStartTime(packetBodyStart, 0, packetBodyLength);
+            HandleDataStartTime(buffer, packetBodyOffset, packetBodyLength);
+            bufferDispatched = true;
             break;
 
         case ServerResponse::ProcessingComplete:
-            HandleProcessingComplete(packetBodyStart, 0, packetBodyLength);
+            HandleProcessingComplete(buffer, packetBodyOffset, packetBodyLength);
+            bufferDispatched = true;
             break;
 
         case ServerResponse::UpdateSignalIndexCache:
@@ -431,6 +536,10 @@ void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uin
             HandleUpdateBaseTimes(packetBodyStart, 0, packetBodyLength);
             break;
 
+        case ServerResponse::UpdateCipherKeys:
+            HandleUpdateCipherKeys(packetBodyStart, 0, packetBodyLength);
+            break;
+
         case ServerResponse::ConfigurationChanged:
             HandleConfigurationChanged(packetBodyStart, 0, packetBodyLength);
             break;
@@ -445,11 +554,14 @@ void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uin
             DispatchErrorMessage(errorMessageStream.str());
             break;
     }
+
+    return bufferDispatched;
 }
 
 // Handles success messages received from the server.
-void DataSubscriber::HandleSucceeded(uint8_t commandCode, uint8_t* data, uint32_t offset, uint32_t length)
+void DataSubscriber::HandleSucceeded(uint8_t commandCode, const BufferPtr& buffer, uint32_t offset, uint32_t length)
 {
+    uint8_t* data = buffer->data();
     const uint32_t messageLength = length / sizeof(char);
     stringstream messageStream;
 
@@ -462,7 +574,7 @@ void DataSubscriber::HandleSucceeded(uint8_t commandCode, uint8_t* data, uint32_
         case ServerCommand::MetadataRefresh:
             // Metadata refresh message is not sent with a
             // message, but rather the metadata itself.
-            HandleMetadataRefresh(data, offset, length);
+            HandleMetadataRefresh(buffer, offset, length);
             break;
 
         case ServerCommand::Subscribe:
@@ -473,6 +585,7 @@ void DataSubscriber::HandleSucceeded(uint8_t commandCode, uint8_t* data, uint32_
 
         case ServerCommand::Authenticate:
         case ServerCommand::RotateCipherKeys:
+        case ServerCommand::UpdateProcessingInterval:
             // Each of these responses come with a message that will
             // be delivered to the user via the status message callback.
             if (data != nullptr)
@@ -522,21 +635,21 @@ void DataSubscriber::HandleFailed(uint8_t commandCode, uint8_t* data, uint32_t o
 }
 
 // Handles metadata refresh messages from the server.
-void DataSubscriber::HandleMetadataRefresh(uint8_t* data, uint32_t offset, uint32_t length)
+void DataSubscriber::HandleMetadataRefresh(const BufferPtr& buffer, uint32_t offset, uint32_t length)
 {
-    Dispatch(&MetadataDispatcher, data, offset, length);
+    Dispatch(&MetadataDispatcher, buffer, offset, length);
 }
 
 // Handles data start time reported by the server at the beginning of a subscription.
-void DataSubscriber::HandleDataStartTime(uint8_t* data, uint32_t offset, uint32_t length)
+void DataSubscriber::HandleDataStartTime(const BufferPtr& buffer, uint32_t offset, uint32_t length)
 {
-    Dispatch(&DataStartTimeDispatcher, data, offset, length);
+    Dispatch(&DataStartTimeDispatcher, buffer, offset, length);
 }
 
 // Handles processing complete message sent by the server at the end of a temporal session.
-void DataSubscriber::HandleProcessingComplete(uint8_t* data, uint32_t offset, uint32_t length)
+void DataSubscriber::HandleProcessingComplete(const BufferPtr& buffer, uint32_t offset, uint32_t length)
 {
-    Dispatch(&ProcessingCompleteDispatcher, data, offset, length);
+    Dispatch(&ProcessingCompleteDispatcher, buffer, offset, length);
 }
 
 // Cache signal IDs sent by the server into the signal index cache.
@@ -583,18 +696,76 @@ void DataSubscriber::HandleUpdateBaseTimes(uint8_t* data, uint32_t offset, uint3
     m_baseTimeOffsets[1] = EndianConverter::Default.ConvertBigEndian(timeOffsetsPtr[1]);
 }
 
+// Updates the cipher key sets used to decrypt data packets. The publisher sends the index of the
+// active key set followed by the even and odd key sets, each as a length-prefixed key and IV.
+void DataSubscriber::HandleUpdateCipherKeys(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    if (data == nullptr || length < 1)
+        return;
+
+    const uint32_t end = offset + length;
+    vector<uint8_t> keys[2], ivs[2];
+
+    // Skip active cipher index, data packets identify the key set they were encrypted with
+    offset++;
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        if (offset + 4 > end)
+        {
+            DispatchErrorMessage("Received truncated cipher key update");
+            return;
+        }
+
+        const uint32_t size = EndianConverter::ToBigEndian<uint32_t>(data, offset);
+        offset += 4;
+
+        if (size > end - offset)
+        {
+            DispatchErrorMessage("Received truncated cipher key update");
+            return;
+        }
+
+        vector<uint8_t>& target = i % 2 == 0 ? keys[i / 2] : ivs[i / 2];
+        target.assign(data + offset, data + offset + size);
+        offset += size;
+    }
+
+    ScopeLock lock(m_cipherLock);
+
+    try
+    {
+        for (int32_t i = 0; i < 2; i++)
+        {
+            if (ivs[i].size() != AesCipher::BlockSize)
+                throw SubscriberException("invalid initialization vector size");
+
+            m_ciphers[i].SetKey(keys[i].data(), static_cast<uint32_t>(keys[i].size()));
+            m_cipherIVs[i] = std::move(ivs[i]);
+        }
+
+        m_cipherKeysDefined = true;
+    }
+    catch (const std::exception& ex)
+    {
+        m_cipherKeysDefined = false;
+        DispatchErrorMessage("Failed to update cipher keys: " + string(ex.what()));
+    }
+}
+
 // Handles configuration changed message sent by the server at the end of a temporal session.
 void DataSubscriber::HandleConfigurationChanged(uint8_t* data, uint32_t offset, uint32_t length)
 {
     Dispatch(&ConfigurationChangedDispatcher);
 }
 
-// Handles data packets from the server. Decodes the measurements and provides them to the user via the new measurements callback.
+// Handles data packets from the server. Decodes the measurements and provides them to the user via the new measurements callbacks.
 void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t length)
 {
     const NewMeasurementsCallback newMeasurementsCallback = m_newMeasurementsCallback;
+    const NewMeasurementValuesCallback newMeasurementValuesCallback = m_newMeasurementValuesCallback;
 
-    if (newMeasurementsCallback != nullptr)
+    if (newMeasurementsCallback != nullptr || newMeasurementValuesCallback != nullptr)
     {
         SubscriptionInfo& info = m_subscriptionInfo;
         uint8_t dataPacketFlags;
@@ -606,6 +777,23 @@ void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t l
         dataPacketFlags = data[offset];
         offset++;
 
+        // Decrypt payload in place when data channel is encrypted
+        if (m_cipherKeysDefined)
+        {
+            const int32_t cipherIndex = (dataPacketFlags & DataPacketFlags::CipherIndex) > 0 ? 1 : 0;
+            ScopeLock lock(m_cipherLock);
+
+            try
+            {
+                length = 1 + m_ciphers[cipherIndex].Decrypt(data + offset, length - 1, m_cipherIVs[cipherIndex].data());
+            }
+            catch (const std::exception& ex)
+            {
+                DispatchErrorMessage("Failed to decrypt data packet: " + string(ex.what()));
+                return;
+            }
+        }
+
         // Read frame-level timestamp, if available
         if (dataPacketFlags & DataPacketFlags::Synchronized)
         {
@@ -619,20 +807,46 @@ void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t l
         m_totalMeasurementsReceived += count;
         offset += 4;
 
-        vector<MeasurementPtr> measurements;
+        // Measurement value buffer is reused between packets so that its
+        // capacity only grows until it reaches the largest packet size
+        vector<MeasurementValue>& values = m_measurementValues;
+        values.clear();
 
         if (dataPacketFlags & DataPacketFlags::Compressed)
-            ParseTSSCMeasurements(data, offset, length, measurements);
+            ParseTSSCMeasurements(data, offset, length, values);
         else
-            ParseCompactMeasurements(data, offset, length, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, measurements);
+            ParseCompactMeasurements(data, offset, length, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, values);
+
+        const uint32_t valueCount = static_cast<uint32_t>(values.size());
+
+        if (newMeasurementValuesCallback != nullptr)
+            newMeasurementValuesCallback(this, values.data(), valueCount);
+
+        if (newMeasurementsCallback != nullptr)
+        {
+            vector<MeasurementPtr> measurements;
+            measurements.reserve(valueCount);
+
+            for (uint32_t i = 0; i < valueCount; i++)
+            {
+                const MeasurementValue& value = values[i];
+                MeasurementPtr measurement = NewSharedPtr<Measurement>();
+
+                m_signalIndexCache->GetMeasurementKey(value.RuntimeID, measurement->SignalID, measurement->Source, measurement->ID);
+                measurement->Timestamp = value.Timestamp;
+                measurement->Flags = value.Flags;
+                measurement->Value = value.Value;
+
+                measurements.push_back(measurement);
+            }
 
-        newMeasurementsCallback(this, measurements);
+            newMeasurementsCallback(this, measurements);
+        }
     }
 }
 
-void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementPtr>& measurements)
+void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementValue>& measurements)
 {
-    MeasurementPtr measurement;
     string errorMessage;
 
     if (data[offset] != 85)
@@ -684,9 +898,7 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
     {
         m_tsscMeasurementParser.SetBuffer(data, offset, length);
 
-        Guid signalID;
-        string measurementSource;
-        uint32_t measurementID;
+        MeasurementValue measurement;
         uint16_t id;
         int64_t time;
         uint32_t quality;
@@ -694,16 +906,15 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
 
         while (m_tsscMeasurementParser.TryGetMeasurement(id, time, quality, value))
         {
-            if (m_signalIndexCache->GetMeasurementKey(id, signalID, measurementSource, measurementID))
-            {
-                measurement = NewSharedPtr<Measurement>();
+            const SignalIndexRecord* record = m_signalIndexCache != nullptr ? m_signalIndexCache->GetRecord(id) : nullptr;
 
-                measurement->SignalID = signalID;
-                measurement->Source = measurementSource;
-                measurement->ID = measurementID;
-                measurement->Timestamp = time;
-                measurement->Flags = quality;
-                measurement->Value = value;
+            if (record != nullptr)
+            {
+                measurement.RuntimeID = id;
+                measurement.SignalID = record->SignalID;
+                measurement.Timestamp = time;
+                measurement.Flags = quality;
+                measurement.Value = value;
 
                 measurements.push_back(measurement);
             }
@@ -733,7 +944,7 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         m_tsscSequenceNumber = 1;
 }
 
-void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, vector<MeasurementPtr>& measurements)
+void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, vector<MeasurementValue>& measurements)
 {
     const MessageCallback errorMessageCallback = m_errorMessageCallback;
 
@@ -743,10 +954,10 @@ void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, ui
     // Create measurement parser
     CompactMeasurement parser(m_signalIndexCache, m_baseTimeOffsets, includeTime, useMillisecondResolution);
 
+    MeasurementValue measurement;
+
     while (length != offset)
     {
-        MeasurementPtr measurement;
-
         if (!parser.TryParseMeasurement(data, offset, length, measurement))
         {
             if (errorMessageCallback != nullptr)
@@ -756,7 +967,7 @@ void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, ui
         }
 
         if (frameLevelTimestamp > -1)
-            measurement->Timestamp = frameLevelTimestamp;
+            measurement.Timestamp = frameLevelTimestamp;
 
         measurements.push_back(measurement);
     }
@@ -772,21 +983,57 @@ void DataSubscriber::Dispatch(const DispatcherFunction& function)
 void DataSubscriber::Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length)
 {
     CallbackDispatcher dispatcher;
-    SharedPtr<vector<uint8_t>> dataVector = NewSharedPtr<vector<uint8_t>>();
+    const BufferPtr dataVector = m_callbackBufferPool.Acquire(length);
 
-    dataVector->resize(length);
-
-    if (data != nullptr)
-    {
-        for (uint32_t i = 0; i < length; ++i)
-            dataVector->at(i) = data[offset + i];
-    }
+    if (data != nullptr && length > 0)
+        memcpy(dataVector->data(), data + offset, length);
 
     dispatcher.Source = this;
     dispatcher.Data = dataVector;
+    dispatcher.Length = length;
     dispatcher.Function = function;
+    dispatcher.ReleaseData = true;
+
+    if (m_boundedCallbackQueue != nullptr)
+        m_boundedCallbackQueue->Enqueue(std::move(dispatcher));
+    else
+        m_callbackQueue.Enqueue(std::move(dispatcher));
+}
+
+// Dispatches the given function to the callback thread and provides it with a slice of the given buffer.
+// The buffer is shared rather than copied, so it must not be modified while the dispatch is pending.
+void DataSubscriber::Dispatch(const DispatcherFunction& function, const BufferPtr& buffer, uint32_t offset, uint32_t length)
+{
+    CallbackDispatcher dispatcher;
+
+    dispatcher.Source = this;
+    dispatcher.Data = buffer;
+    dispatcher.Offset = offset;
+    dispatcher.Length = length;
+    dispatcher.Function = function;
+
+    if (m_boundedCallbackQueue != nullptr)
+        m_boundedCallbackQueue->Enqueue(std::move(dispatcher));
+    else
+        m_callbackQueue.Enqueue(std::move(dispatcher));
+}
+
+// Hands a buffer that responses were dispatched from over to the callback thread. The callback
+// thread returns the buffer to the pool when it reaches this dispatch, i.e., after it has handled
+// every response dispatched before it. If the dispatch is dropped by a bounded queue, the buffer
+// is simply freed once the last response referring to it has been handled.
+void DataSubscriber::ReleaseDispatchedBuffer(const BufferPtr& buffer)
+{
+    CallbackDispatcher dispatcher;
 
-    m_callbackQueue.Enqueue(dispatcher);
+    dispatcher.Source = this;
+    dispatcher.Data = buffer;
+    dispatcher.ReleaseData = true;
+
+    if (m_boundedCallbackQueue != nullptr)
+        m_boundedCallbackQueue->Enqueue(std::move(dispatcher));
+    else
+        m_callbackQueue.Enqueue(std::move(dispatcher));
 }
 
 // Invokes the status message callback on the callback thread and provides the given message to it.
@@ -804,7 +1051,7 @@ void DataSubscriber::DispatchErrorMessage(const string& message)
 }
 
 // Dispatcher function for status messages. Decodes the message and provides it to the user via the status message callback.
-void DataSubscriber::StatusMessageDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+void DataSubscriber::StatusMessageDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length)
 {
     if (source == nullptr)
         return;
@@ -812,11 +1059,11 @@ void DataSubscriber::StatusMessageDispatcher(DataSubscriber* source, const vecto
     const MessageCallback statusMessageCallback = source->m_statusMessageCallback;
     
     if (statusMessageCallback != nullptr)
-        statusMessageCallback(source, reinterpret_cast<const char*>(&buffer[0]));
+        statusMessageCallback(source, reinterpret_cast<const char*>(data));
 }
 
 // Dispatcher function for error messages. Decodes the message and provides it to the user via the error message callback.
-void DataSubscriber::ErrorMessageDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+void DataSubscriber::ErrorMessageDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length)
 {
     if (source == nullptr)
         return;
@@ -824,11 +1071,11 @@ void DataSubscriber::ErrorMessageDispatcher(DataSubscriber* source, const vector
     const MessageCallback errorMessageCallback = source->m_errorMessageCallback;
 
     if (errorMessageCallback != nullptr)
-        errorMessageCallback(source, reinterpret_cast<const char*>(&buffer[0]));
+        errorMessageCallback(source, reinterpret_cast<const char*>(data));
 }
 
 // Dispatcher function for data start time. Decodes the start time and provides it to the user via the data start time callback.
-void DataSubscriber::DataStartTimeDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+void DataSubscriber::DataStartTimeDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length)
 {
     if (source == nullptr)
         return;
@@ -837,13 +1084,13 @@ void DataSubscriber::DataStartTimeDispatcher(DataSubscriber* source, const vecto
 
     if (dataStartTimeCallback != nullptr)
     {
-        const int64_t dataStartTime = EndianConverter::ToBigEndian<int64_t>(buffer.data(), 0);
+        const int64_t dataStartTime = EndianConverter::ToBigEndian<int64_t>(data, 0);
         dataStartTimeCallback(source, dataStartTime);
     }
 }
 
 // Dispatcher function for metadata. Provides encoded metadata to the user via the metadata callback.
-void DataSubscriber::MetadataDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+void DataSubscriber::MetadataDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length)
 {
     if (source == nullptr)
         return;
@@ -851,11 +1098,11 @@ void DataSubscriber::MetadataDispatcher(DataSubscriber* source, const vector<uin
     const MetadataCallback metadataCallback = source->m_metadataCallback;
 
     if (metadataCallback != nullptr)
-        metadataCallback(source, buffer);
+        metadataCallback(source, vector<uint8_t>(data, data + length));
 }
 
 // Dispatcher for processing complete message that is sent by the server at the end of a temporal session.
-void DataSubscriber::ProcessingCompleteDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+void DataSubscriber::ProcessingCompleteDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length)
 {
     if (source == nullptr)
         return;
@@ -864,17 +1111,12 @@ void DataSubscriber::ProcessingCompleteDispatcher(DataSubscriber* source, const
 
     if (processingCompleteCallback != nullptr)
     {
-        stringstream messageStream;
-
-        for (uint32_t i = 0; i < buffer.size(); ++i)
-            messageStream << buffer[i];
-
-        processingCompleteCallback(source, messageStream.str());
+        processingCompleteCallback(source, string(reinterpret_cast<const char*>(data), length));
     }
 }
 
 // Dispatcher for processing complete message that is sent by the server at the end of a temporal session.
-void DataSubscriber::ConfigurationChangedDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+void DataSubscriber::ConfigurationChangedDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length)
 {
     if (source == nullptr)
         return;
@@ -924,6 +1166,12 @@ void DataSubscriber::RegisterNewMeasurementsCallback(const NewMeasurementsCallba
     m_newMeasurementsCallback = newMeasurementsCallback;
 }
 
+// Registers the new measurement values callback.
+void DataSubscriber::RegisterNewMeasurementValuesCallback(const NewMeasurementValuesCallback& newMeasurementValuesCallback)
+{
+    m_newMeasurementValuesCallback = newMeasurementValuesCallback;
+}
+
 // Registers the processing complete callback.
 void DataSubscriber::RegisterProcessingCompleteCallback(const MessageCallback& processingCompleteCallback)
 {
@@ -996,6 +1244,30 @@ void DataSubscriber::SetSignalIndexCacheCompressed(bool compressed)
         SendOperationalModes();
 }
 
+// Gets the maximum number of pending callbacks, zero means unbounded.
+uint32_t DataSubscriber::GetCallbackQueueCapacity() const
+{
+    return m_callbackQueueCapacity;
+}
+
+// Sets the maximum number of pending callbacks, takes effect on next connect.
+void DataSubscriber::SetCallbackQueueCapacity(uint32_t capacity)
+{
+    m_callbackQueueCapacity = capacity;
+}
+
+// Gets the policy applied when the bounded callback queue is full.
+QueueOverflowPolicy DataSubscriber::GetCallbackQueueOverflowPolicy() const
+{
+    return m_callbackQueueOverflowPolicy;
+}
+
+// Sets the policy applied when the bounded callback queue is full, takes effect on next connect.
+void DataSubscriber::SetCallbackQueueOverflowPolicy(QueueOverflowPolicy overflowPolicy)
+{
+    m_callbackQueueOverflowPolicy = overflowPolicy;
+}
+
 // Gets user defined data reference
 void* DataSubscriber::GetUserData() const
 {
@@ -1051,7 +1323,19 @@ void DataSubscriber::Connect(const string& hostname, const uint16_t port)
     m_hostAddress = hostEndpoint->endpoint().address();
 
     m_commandChannelService.restart();
-    m_callbackThread = Thread(bind(&DataSubscriber::RunCallbackThread, this));
+
+    // Callback queue selection is applied here while no subscriber threads are running
+    if (m_callbackQueueCapacity > 0)
+    {
+        m_boundedCallbackQueue = NewSharedPtr<RingBuffer<CallbackDispatcher>>(m_callbackQueueCapacity, m_callbackQueueOverflowPolicy);
+        m_callbackThread = Thread(bind(&DataSubscriber::RunBoundedCallbackThread, this));
+    }
+    else
+    {
+        m_boundedCallbackQueue.reset();
+        m_callbackThread = Thread(bind(&DataSubscriber::RunCallbackThread, this));
+    }
+
     m_commandChannelResponseThread = Thread(bind(&DataSubscriber::RunCommandChannelResponseThread, this));
 
     SendOperationalModes();
@@ -1071,6 +1355,10 @@ void DataSubscriber::Disconnect(bool autoReconnect)
     // Release queues and close sockets so
     // that threads can shut down gracefully
     m_callbackQueue.Release();
+
+    if (m_boundedCallbackQueue != nullptr)
+        m_boundedCallbackQueue->Release();
+
     m_commandChannelSocket.close(error);
     m_dataChannelSocket.shutdown(UdpSocket::shutdown_receive, error);
     m_dataChannelSocket.close(error);
@@ -1086,6 +1374,12 @@ void DataSubscriber::Disconnect(bool autoReconnect)
     m_callbackQueue.Clear();
     m_callbackQueue.Reset();
 
+    if (m_boundedCallbackQueue != nullptr)
+    {
+        m_boundedCallbackQueue->Clear();
+        m_boundedCallbackQueue->Reset();
+    }
+
     // Notify consumers of disconnect
     if (m_connectionTerminatedCallback != nullptr)
         m_connectionTerminatedCallback(this);
@@ -1142,6 +1436,9 @@ void DataSubscriber::Subscribe()
 
     m_totalMeasurementsReceived = 0UL;
 
+    // Publisher sends new cipher keys when the subscription encrypts its data channel
+    m_cipherKeysDefined = false;
+
     connectionStream << "trackLatestMeasurements=" << m_subscriptionInfo.Throttled << ";";
     connectionStream << "includeTime=" << m_subscriptionInfo.IncludeTime << ";";
     connectionStream << "lagTime=" << m_subscriptionInfo.LagTime << ";";
@@ -1362,6 +1659,15 @@ uint64_t DataSubscriber::GetTotalMeasurementsReceived() const
     return m_totalMeasurementsReceived;
 }
 
+// Gets the total number of callbacks dropped by the bounded callback queue since last connection.
+uint64_t DataSubscriber::GetTotalCallbacksDropped() const
+{
+    if (m_boundedCallbackQueue == nullptr)
+        return 0UL;
+
+    return m_boundedCallbackQueue->GetDroppedCount();
+}
+
 // Indicates whether the subscriber is connected.
 bool DataSubscriber::IsConnected() const
 {
@@ -29,7 +29,11 @@
 #include "TransportTypes.h"
 #include "SignalIndexCache.h"
 #include "TSSCMeasurementParser.h"
+#include "../Common/AesCipher.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/BufferPool.h"
+#include "../Common/RingBuffer.h"
+#include <atomic>
 
 namespace GSF {
 namespace TimeSeries {
@@ -136,22 +140,31 @@ namespace Transport
     {
     private:
         // Function pointer types
-        typedef std::function<void(DataSubscriber*, const std::vector<uint8_t>&)> DispatcherFunction;
+        typedef std::function<void(DataSubscriber*, const uint8_t*, uint32_t)> DispatcherFunction;
         typedef std::function<void(DataSubscriber*, const std::string&)> MessageCallback;
         typedef std::function<void(DataSubscriber*, int64_t)> DataStartTimeCallback;
         typedef std::function<void(DataSubscriber*, const std::vector<uint8_t>&)> MetadataCallback;
         typedef std::function<void(DataSubscriber*, const std::vector<MeasurementPtr>&)> NewMeasurementsCallback;
+        typedef std::function<void(DataSubscriber*, const MeasurementValue*, uint32_t)> NewMeasurementValuesCallback;
         typedef std::function<void(DataSubscriber*)> ConfigurationChangedCallback;
         typedef std::function<void(DataSubscriber*)> ConnectionTerminatedCallback;
 
-        // Structure used to dispatch
-        // callbacks on the callback thread.
+        // Structure used to dispatch callbacks on the callback thread.
+        // Data may be shared with other dispatchers, e.g., a command
+        // channel receive buffer, so the dispatched payload is the
+        // slice of Data starting at Offset.
         struct CallbackDispatcher
         {
             DataSubscriber* Source;
-            SharedPtr<std::vector<uint8_t>> Data;
+            BufferPtr Data;
+            uint32_t Offset;
+            uint32_t Length;
             DispatcherFunction Function;
 
+            // Set when the dispatcher exclusively owns Data,
+            // which is then returned to the buffer pool
+            bool ReleaseData;
+
             CallbackDispatcher();
         };
 
@@ -179,16 +192,30 @@ namespace Transport
         TSSCMeasurementParser m_tsscMeasurementParser;
         bool m_tsscResetRequested;
         uint16_t m_tsscSequenceNumber;
+        std::vector<MeasurementValue> m_measurementValues;
+
+        // Cipher key sets used to decrypt data packets received on the data channel
+        AesCipher m_ciphers[2];
+        std::vector<uint8_t> m_cipherIVs[2];
+        std::atomic<bool> m_cipherKeysDefined;
+        Mutex m_cipherLock;
 
         // Callback thread members
         Thread m_callbackThread;
         ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
+        SharedPtr<RingBuffer<CallbackDispatcher>> m_boundedCallbackQueue;
+        uint32_t m_callbackQueueCapacity;
+        QueueOverflowPolicy m_callbackQueueOverflowPolicy;
+        BufferPool m_callbackBufferPool;
 
         // Command channel
         Thread m_commandChannelResponseThread;
         boost::asio::io_context m_commandChannelService;
         TcpSocket m_commandChannelSocket;
-        std::vector<uint8_t> m_readBuffer;
+        BufferPtr m_readBuffer;
+        bool m_readBufferDispatched;
+        uint32_t m_readOffset;
+        uint32_t m_readLength;
         std::vector<uint8_t> m_writeBuffer;
 
         // Data channel
@@ -202,6 +229,7 @@ namespace Transport
         DataStartTimeCallback m_dataStartTimeCallback;
         MetadataCallback m_metadataCallback;
         NewMeasurementsCallback m_newMeasurementsCallback;
+        NewMeasurementValuesCallback m_newMeasurementValuesCallback;
         MessageCallback m_processingCompleteCallback;
         ConfigurationChangedCallback m_configurationChangedCallback;
         ConnectionTerminatedCallback m_connectionTerminatedCallback;
@@ -209,40 +237,44 @@ namespace Transport
 
         // Threads
         void RunCallbackThread();
+        void RunBoundedCallbackThread();
         void RunCommandChannelResponseThread();
         void RunDataChannelResponseThread();
 
         // Command channel callbacks
-        void ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred);
-        void ReadPacket(const ErrorCode& error, uint32_t bytesTransferred);
+        void ReadCommandChannel();
+        void ReadResponses(const ErrorCode& error, uint32_t bytesTransferred);
         void WriteHandler(const ErrorCode& error, uint32_t bytesTransferred);
 
         // Server response handlers
-        void ProcessServerResponse(uint8_t* buffer, uint32_t offset, uint32_t length);
-        void HandleSucceeded(uint8_t commandCode, uint8_t* data, uint32_t offset, uint32_t length);
+        bool ProcessServerResponse(const BufferPtr& buffer, uint32_t offset, uint32_t length);
+        void HandleSucceeded(uint8_t commandCode, const BufferPtr& buffer, uint32_t offset, uint32_t length);
         void HandleFailed(uint8_t commandCode, uint8_t* data, uint32_t offset, uint32_t length);
-        void HandleMetadataRefresh(uint8_t* data, uint32_t offset, uint32_t length);
-        void HandleDataStartTime(uint8_t* data, uint32_t offset, uint32_t length);
-        void HandleProcessingComplete(uint8_t* data, uint32_t offset, uint32_t length);
+        void HandleMetadataRefresh(const BufferPtr& buffer, uint32_t offset, uint32_t length);
+        void HandleDataStartTime(const BufferPtr& buffer, uint32_t offset, uint32_t length);
+        void HandleProcessingComplete(const BufferPtr& buffer, uint32_t offset, uint32_t length);
         void HandleUpdateSignalIndexCache(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleUpdateBaseTimes(uint8_t* data, uint32_t offset, uint32_t length);
+        void HandleUpdateCipherKeys(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleConfigurationChanged(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t length);
-        void ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementPtr>& measurements);
-        void ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, std::vector<MeasurementPtr>& measurements);
+        void ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementValue>& measurements);
+        void ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, std::vector<MeasurementValue>& measurements);
 
         // Dispatchers
         void Dispatch(const DispatcherFunction& function);
         void Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length);
+        void Dispatch(const DispatcherFunction& function, const BufferPtr& buffer, uint32_t offset, uint32_t length);
+        void ReleaseDispatchedBuffer(const BufferPtr& buffer);
         void DispatchStatusMessage(const std::string& message);
         void DispatchErrorMessage(const std::string& message);
 
-        static void StatusMessageDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void ErrorMessageDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void DataStartTimeDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void MetadataDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void ProcessingCompleteDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void ConfigurationChangedDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
+        static void StatusMessageDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length);
+        static void ErrorMessageDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length);
+        static void DataStartTimeDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length);
+        static void MetadataDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length);
+        static void ProcessingCompleteDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length);
+        static void ConfigurationChangedDispatcher(DataSubscriber* source, const uint8_t* data, uint32_t length);
 
         // The connection terminated callback is a special case that
         // must be called on its own separate thread so that it can
@@ -268,17 +300,24 @@ namespace Transport
         //   void ProcessDataStartTime(DataSubscriber*, int64_t startTime)
         //   void ProcessMetadata(DataSubscriber*, const vector<uint8_t>& metadata)
         //   void ProcessNewMeasurements(DataSubscriber*, const vector<MeasurementPtr>& newMeasurements)
+        //   void ProcessNewMeasurementValues(DataSubscriber*, const MeasurementValue* values, uint32_t count)
         //   void ProcessProcessingComplete(DataSubscriber*, const string& message)
         //   void ProcessConfigurationChanged(DataSubscriber*)
         //   void ProcessConnectionTerminated(DataSubscriber*)
         //
         // Metadata is provided to the user as zlib-compressed XML,
         // and must be decompressed and interpreted before it can be used.
+        //
+        // Measurement values are delivered from a buffer owned by the subscriber
+        // that is reused for each data packet, so the pointer is only valid for
+        // the duration of the callback. Unlike new measurements, no per-measurement
+        // allocations are performed for this callback.
         void RegisterStatusMessageCallback(const MessageCallback& statusMessageCallback);
         void RegisterErrorMessageCallback(const MessageCallback& errorMessageCallback);
         void RegisterDataStartTimeCallback(const DataStartTimeCallback& dataStartTimeCallback);
         void RegisterMetadataCallback(const MetadataCallback& metadataCallback);
         void RegisterNewMeasurementsCallback(const NewMeasurementsCallback& newMeasurementsCallback);
+        void RegisterNewMeasurementValuesCallback(const NewMeasurementValuesCallback& newMeasurementValuesCallback);
         void RegisterProcessingCompleteCallback(const MessageCallback& processingCompleteCallback);
         void RegisterConfigurationChangedCallback(const ConfigurationChangedCallback& configurationChangedCallback);
         void RegisterConnectionTerminatedCallback(const ConnectionTerminatedCallback& connectionTerminatedCallback);
@@ -301,6 +340,16 @@ namespace Transport
         bool IsSignalIndexCacheCompressed() const;
         void SetSignalIndexCacheCompressed(bool compressed);
 
+        // Gets or sets the maximum number of callbacks that can be pending on the callback
+        // thread. The default of zero uses an unbounded queue, any other value uses a bounded
+        // lock-free ring buffer that applies the overflow policy when it is full. Changes to
+        // these settings take effect the next time the subscriber connects.
+        uint32_t GetCallbackQueueCapacity() const;
+        void SetCallbackQueueCapacity(uint32_t capacity);
+
+        QueueOverflowPolicy GetCallbackQueueOverflowPolicy() const;
+        void SetCallbackQueueOverflowPolicy(QueueOverflowPolicy overflowPolicy);
+
         // Gets or sets user defined data reference
         void* GetUserData() const;
         void SetUserData(void* userData);
@@ -355,6 +404,7 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesReceived() const;
         uint64_t GetTotalDataChannelBytesReceived() const;
         uint64_t GetTotalMeasurementsReceived() const;
+        uint64_t GetTotalCallbacksDropped() const;
         bool IsConnected() const;
         bool IsSubscribed() const;
     };
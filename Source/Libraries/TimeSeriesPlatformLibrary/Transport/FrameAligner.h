@@ -0,0 +1,268 @@
+//******************************************************************************************************
+//  FrameAligner.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FRAME_ALIGNER_H
+#define __FRAME_ALIGNER_H
+
+#include "TransportTypes.h"
+#include "../Common/Convert.h"
+#include <deque>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Time alignment core of the frame assembler and the frame concentrator.
+    //
+    // Frame slots are kept sorted by timestamp and handed to the publish callback once real
+    // time has moved more than the lag time past their timestamp. Measurements further than
+    // the lead time ahead of the local clock, or late for a frame that was already published,
+    // are rejected. Real time is the local clock or the latest measurement timestamp.
+    //
+    // Slots must have an int64_t Timestamp member and a Clear method that keeps the capacity
+    // of their buffers, published slots are cleared and reused. The aligner does no locking,
+    // callers serialize access with their own lock.
+    template<typename TSlot>
+    class FrameAligner // NOLINT
+    {
+    public:
+        typedef std::function<void(TSlot&)> PublishSlotCallback;
+
+    private:
+        typedef SharedPtr<TSlot> SlotPtr;
+
+        std::deque<SlotPtr> m_slots;
+        std::vector<SlotPtr> m_freeSlots;
+        PublishSlotCallback m_publishSlot;
+
+        uint32_t m_framesPerSecond;
+        int64_t m_lagTicks;
+        int64_t m_leadTicks;
+        bool m_useLocalClockAsRealTime;
+        int64_t m_realTime;
+        int64_t m_lastPublishedTimestamp;
+        uint64_t m_discardedMeasurements;
+        uint64_t m_publishedFrames;
+
+        void PublishSlots(bool publishAll)
+        {
+            while (!m_slots.empty() && (publishAll || m_slots.front()->Timestamp + m_lagTicks <= m_realTime))
+            {
+                SlotPtr slot = m_slots.front();
+                m_slots.pop_front();
+
+                m_publishSlot(*slot);
+                m_publishedFrames++;
+                m_lastPublishedTimestamp = slot->Timestamp;
+
+                slot->Clear();
+                m_freeSlots.push_back(slot);
+            }
+        }
+
+    public:
+        FrameAligner(const PublishSlotCallback& publishSlot, uint32_t framesPerSecond, float64_t lagTime, float64_t leadTime, bool useLocalClockAsRealTime) :
+            m_publishSlot(publishSlot),
+            m_framesPerSecond(framesPerSecond > 0 ? framesPerSecond : 30),
+            m_lagTicks(static_cast<int64_t>(lagTime * Ticks::PerSecond)),
+            m_leadTicks(static_cast<int64_t>(leadTime * Ticks::PerSecond)),
+            m_useLocalClockAsRealTime(useLocalClockAsRealTime),
+            m_realTime(Int64::MinValue),
+            m_lastPublishedTimestamp(Int64::MinValue),
+            m_discardedMeasurements(0UL),
+            m_publishedFrames(0UL)
+        {
+        }
+
+        uint32_t GetFramesPerSecond() const
+        {
+            return m_framesPerSecond;
+        }
+
+        void SetFramesPerSecond(uint32_t framesPerSecond)
+        {
+            m_framesPerSecond = framesPerSecond > 0 ? framesPerSecond : 30;
+        }
+
+        // Gets the time between frames in milliseconds, e.g., to schedule PublishReadyFrames.
+        int32_t GetFrameInterval() const
+        {
+            return m_framesPerSecond < 1000 ? static_cast<int32_t>(1000 / m_framesPerSecond) : 1;
+        }
+
+        float64_t GetLagTime() const
+        {
+            return static_cast<float64_t>(m_lagTicks) / Ticks::PerSecond;
+        }
+
+        void SetLagTime(float64_t lagTime)
+        {
+            m_lagTicks = static_cast<int64_t>(lagTime * Ticks::PerSecond);
+        }
+
+        float64_t GetLeadTime() const
+        {
+            return static_cast<float64_t>(m_leadTicks) / Ticks::PerSecond;
+        }
+
+        void SetLeadTime(float64_t leadTime)
+        {
+            m_leadTicks = static_cast<int64_t>(leadTime * Ticks::PerSecond);
+        }
+
+        bool GetUseLocalClockAsRealTime() const
+        {
+            return m_useLocalClockAsRealTime;
+        }
+
+        void SetUseLocalClockAsRealTime(bool useLocalClockAsRealTime)
+        {
+            m_useLocalClockAsRealTime = useLocalClockAsRealTime;
+        }
+
+        // Gets real time for a batch of measurements received at the given local clock time.
+        int64_t GetRealTime(int64_t localClock) const
+        {
+            return m_useLocalClockAsRealTime ? localClock : m_realTime;
+        }
+
+        // Determines whether a measurement with the given timestamp is accepted into the frame
+        // at the frame timestamp, moving the batch real time forward when the local clock is not
+        // used. Rejected measurements are counted as discarded.
+        bool TryAccept(int64_t timestamp, int64_t frameTimestamp, int64_t localClock, int64_t& realTime)
+        {
+            // Reject measurements too far ahead of the local clock to be reasonable
+            if (timestamp > localClock + m_leadTicks)
+            {
+                m_discardedMeasurements++;
+                return false;
+            }
+
+            if (!m_useLocalClockAsRealTime && timestamp > realTime)
+                realTime = timestamp;
+
+            // Reject measurements that arrived too late for their frame
+            if (frameTimestamp <= m_lastPublishedTimestamp || frameTimestamp + m_lagTicks <= realTime)
+            {
+                m_discardedMeasurements++;
+                return false;
+            }
+
+            return true;
+        }
+
+        // Gets the slot for the given frame timestamp, creating it if needed. New timestamps
+        // normally arrive in order, so the search for the slot starts from the most recent one.
+        TSlot& GetSlot(int64_t frameTimestamp)
+        {
+            auto iterator = m_slots.end();
+
+            while (iterator != m_slots.begin())
+            {
+                const auto previous = iterator - 1;
+
+                if ((*previous)->Timestamp == frameTimestamp)
+                    return **previous;
+
+                if ((*previous)->Timestamp < frameTimestamp)
+                    break;
+
+                iterator = previous;
+            }
+
+            SlotPtr slot;
+
+            if (m_freeSlots.empty())
+            {
+                slot = NewSharedPtr<TSlot>();
+            }
+            else
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+
+            slot->Timestamp = frameTimestamp;
+
+            return **m_slots.insert(iterator, slot);
+        }
+
+        // Sets real time at the end of a batch of measurements and publishes the frames it has moved past.
+        void Advance(int64_t realTime)
+        {
+            m_realTime = realTime;
+            PublishSlots(false);
+        }
+
+        // Publishes the frames that real time has moved past, updating real time from the local clock when it is used.
+        void PublishReadyFrames()
+        {
+            if (m_useLocalClockAsRealTime)
+                m_realTime = ToTicks(UtcNow());
+
+            PublishSlots(false);
+        }
+
+        // Publishes all pending frames and resets real time, so that data following the flush,
+        // e.g., from a replayed or restarted session, is not rejected as late.
+        void Flush()
+        {
+            PublishSlots(true);
+            m_realTime = Int64::MinValue;
+            m_lastPublishedTimestamp = Int64::MinValue;
+        }
+
+        // Discards all pending frames and resets real time.
+        void Reset()
+        {
+            for (SlotPtr& slot : m_slots)
+            {
+                slot->Clear();
+                m_freeSlots.push_back(slot);
+            }
+
+            m_slots.clear();
+            m_realTime = Int64::MinValue;
+            m_lastPublishedTimestamp = Int64::MinValue;
+        }
+
+        // Discards pending and reusable slots, e.g., when the layout of new slots changes.
+        void Clear()
+        {
+            m_slots.clear();
+            m_freeSlots.clear();
+        }
+
+        uint64_t GetDiscardedMeasurements() const
+        {
+            return m_discardedMeasurements;
+        }
+
+        uint64_t GetPublishedFrames() const
+        {
+            return m_publishedFrames;
+        }
+    };
+}}}
+
+#endif
@@ -0,0 +1,212 @@
+//******************************************************************************************************
+//  FrameAssembler.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FrameAssembler.h"
+#include "../Common/Convert.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+DeviceFrame::DeviceFrame() :
+    Configuration(nullptr),
+    Timestamp(0)
+{
+}
+
+FrameAssembler::FrameAssembler(float64_t lagTime, float64_t leadTime, bool useLocalClockAsRealTime) :
+    m_frameAligner([this](FrameSlot& frameSlot) { PublishFrameSlot(frameSlot); }, 30, lagTime, leadTime, useLocalClockAsRealTime),
+    m_newFramesCallback(nullptr),
+    m_userData(nullptr)
+{
+}
+
+// Clears frames for reuse, measurement buffers keep their capacity.
+void FrameAssembler::FrameSlot::Clear()
+{
+    for (DeviceFrame* frame : ActiveFrames)
+        frame->Measurements.clear();
+
+    ActiveFrames.clear();
+}
+
+void FrameAssembler::PublishFrameSlot(FrameSlot& frameSlot)
+{
+    if (m_newFramesCallback != nullptr)
+        m_newFramesCallback(this, frameSlot.Timestamp, frameSlot.ActiveFrames);
+}
+
+uint32_t FrameAssembler::GetFramesPerSecond() const
+{
+    return m_frameAligner.GetFramesPerSecond();
+}
+
+void FrameAssembler::SetFramesPerSecond(uint32_t framesPerSecond)
+{
+    m_frameAligner.SetFramesPerSecond(framesPerSecond);
+}
+
+int32_t FrameAssembler::GetFrameInterval() const
+{
+    return m_frameAligner.GetFrameInterval();
+}
+
+float64_t FrameAssembler::GetLagTime() const
+{
+    return m_frameAligner.GetLagTime();
+}
+
+void FrameAssembler::SetLagTime(float64_t lagTime)
+{
+    m_frameAligner.SetLagTime(lagTime);
+}
+
+float64_t FrameAssembler::GetLeadTime() const
+{
+    return m_frameAligner.GetLeadTime();
+}
+
+void FrameAssembler::SetLeadTime(float64_t leadTime)
+{
+    m_frameAligner.SetLeadTime(leadTime);
+}
+
+bool FrameAssembler::GetUseLocalClockAsRealTime() const
+{
+    return m_frameAligner.GetUseLocalClockAsRealTime();
+}
+
+void FrameAssembler::SetUseLocalClockAsRealTime(bool useLocalClockAsRealTime)
+{
+    m_frameAligner.SetUseLocalClockAsRealTime(useLocalClockAsRealTime);
+}
+
+void FrameAssembler::DefineConfigurationFrames(const StringMap<ConfigurationFramePtr>& configurationFrames)
+{
+    ScopeLock lock(m_frameLock);
+
+    m_configurationFrames.clear();
+    m_frameIndexes.clear();
+
+    for (auto const& item : configurationFrames)
+    {
+        const uint32_t frameIndex = static_cast<uint32_t>(m_configurationFrames.size());
+        const ConfigurationFramePtr& configurationFrame = item.second;
+
+        m_configurationFrames.push_back(configurationFrame);
+
+        for (auto const& signalID : configurationFrame->Measurements)
+            m_frameIndexes[signalID] = frameIndex;
+    }
+
+    // Pending frames are sized for the previous configuration
+    m_frameAligner.Clear();
+}
+
+void FrameAssembler::AddMeasurements(const MeasurementValue* measurements, uint32_t count)
+{
+    ScopeLock lock(m_frameLock);
+
+    if (m_frameIndexes.empty())
+        return;
+
+    const int64_t localClock = ToTicks(UtcNow());
+    int64_t realTime = m_frameAligner.GetRealTime(localClock);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const MeasurementValue& measurement = measurements[i];
+        const auto iterator = m_frameIndexes.find(measurement.SignalID);
+
+        if (iterator == m_frameIndexes.end())
+            continue;
+
+        const int64_t timestamp = measurement.Timestamp;
+
+        if (!m_frameAligner.TryAccept(timestamp, timestamp, localClock, realTime))
+            continue;
+
+        FrameSlot& frameSlot = m_frameAligner.GetSlot(timestamp);
+
+        // New slots are sized for the current configuration on first use
+        if (frameSlot.Frames.empty())
+            frameSlot.Frames.resize(m_configurationFrames.size());
+
+        DeviceFrame& frame = frameSlot.Frames[iterator->second];
+
+        if (frame.Measurements.empty())
+        {
+            frame.Configuration = m_configurationFrames[iterator->second];
+            frame.Timestamp = timestamp;
+            frameSlot.ActiveFrames.push_back(&frame);
+        }
+
+        frame.Measurements.push_back(measurement);
+    }
+
+    m_frameAligner.Advance(realTime);
+}
+
+void FrameAssembler::PublishReadyFrames()
+{
+    ScopeLock lock(m_frameLock);
+    m_frameAligner.PublishReadyFrames();
+}
+
+void FrameAssembler::Flush()
+{
+    ScopeLock lock(m_frameLock);
+    m_frameAligner.Flush();
+}
+
+void FrameAssembler::Reset()
+{
+    ScopeLock lock(m_frameLock);
+    m_frameAligner.Reset();
+}
+
+uint64_t FrameAssembler::GetDiscardedMeasurements() const
+{
+    return m_frameAligner.GetDiscardedMeasurements();
+}
+
+uint64_t FrameAssembler::GetPublishedFrames() const
+{
+    return m_frameAligner.GetPublishedFrames();
+}
+
+void* FrameAssembler::GetUserData() const
+{
+    return m_userData;
+}
+
+void FrameAssembler::SetUserData(void* userData)
+{
+    m_userData = userData;
+}
+
+void FrameAssembler::RegisterNewFramesCallback(const NewFramesCallback& newFramesCallback)
+{
+    m_newFramesCallback = newFramesCallback;
+}
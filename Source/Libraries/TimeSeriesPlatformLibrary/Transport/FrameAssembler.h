@@ -0,0 +1,141 @@
+//******************************************************************************************************
+//  FrameAssembler.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FRAME_ASSEMBLER_H
+#define __FRAME_ASSEMBLER_H
+
+#include "TransportTypes.h"
+#include "FrameAligner.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Measurements received for a single configuration frame, i.e., device, at one timestamp.
+    struct DeviceFrame
+    {
+        // Configuration frame that defines the measurements of the device.
+        ConfigurationFramePtr Configuration;
+
+        // The time, in ticks, shared by all measurements of the frame.
+        int64_t Timestamp;
+
+        // Measurements received for the device at the frame timestamp.
+        std::vector<MeasurementValue> Measurements;
+
+        DeviceFrame();
+    };
+
+    // Assembles received measurements into frames of time-aligned data.
+    //
+    // Measurements are grouped by their exact timestamp into one device frame per configuration
+    // frame, and each timestamp is published as the set of device frames that received data.
+    // Lag and lead time handling is that of FrameAligner.
+    //
+    // Device frames passed to the new frames callback are only valid for the duration of the
+    // callback, and the callback must not call back into the frame assembler. When the local
+    // clock is used as real time, PublishReadyFrames should be called at the frame interval so
+    // that frames are published while no data is being received.
+    class FrameAssembler // NOLINT
+    {
+    private:
+        typedef std::function<void(FrameAssembler*, int64_t, const std::vector<DeviceFrame*>&)> NewFramesCallback;
+
+        // Device frames for all configuration frames at a single timestamp.
+        struct FrameSlot
+        {
+            int64_t Timestamp;
+            std::vector<DeviceFrame> Frames;
+            std::vector<DeviceFrame*> ActiveFrames;
+
+            void Clear();
+        };
+
+        std::vector<ConfigurationFramePtr> m_configurationFrames;
+        std::unordered_map<Guid, uint32_t> m_frameIndexes;
+        FrameAligner<FrameSlot> m_frameAligner;
+        Mutex m_frameLock;
+
+        NewFramesCallback m_newFramesCallback;
+        void* m_userData;
+
+        void PublishFrameSlot(FrameSlot& frameSlot);
+
+    public:
+        // Creates a new frame assembler with the given lag and lead times, in seconds.
+        FrameAssembler(float64_t lagTime = 10.0, float64_t leadTime = 5.0, bool useLocalClockAsRealTime = false);
+
+        // Gets or sets the expected number of frames per second, which defines the frame interval.
+        uint32_t GetFramesPerSecond() const;
+        void SetFramesPerSecond(uint32_t framesPerSecond);
+
+        // Gets the time between frames, in milliseconds.
+        int32_t GetFrameInterval() const;
+
+        // Gets or sets the allowed past time deviation tolerance, in seconds.
+        float64_t GetLagTime() const;
+        void SetLagTime(float64_t lagTime);
+
+        // Gets or sets the allowed future time deviation tolerance, in seconds.
+        float64_t GetLeadTime() const;
+        void SetLeadTime(float64_t leadTime);
+
+        // Gets or sets flag that determines whether the local clock, rather than
+        // the latest received timestamp, is used as real time.
+        bool GetUseLocalClockAsRealTime() const;
+        void SetUseLocalClockAsRealTime(bool useLocalClockAsRealTime);
+
+        // Defines the configuration frames measurements are assembled into.
+        // Any frames that have not been published yet are discarded.
+        void DefineConfigurationFrames(const GSF::StringMap<ConfigurationFramePtr>& configurationFrames);
+
+        // Sorts the given measurements into frames and publishes any frames
+        // that real time has moved past by more than the lag time.
+        void AddMeasurements(const MeasurementValue* measurements, uint32_t count);
+
+        // Publishes any frames that are ready for publication according to the local
+        // clock. Useful to keep publishing on time when no data is being received.
+        void PublishReadyFrames();
+
+        // Publishes all pending frames and resets real time, e.g., at the end of a temporal session.
+        void Flush();
+
+        // Discards all pending frames and resets real time.
+        void Reset();
+
+        // Gets the total number of measurements discarded for arriving outside the lag and lead times.
+        uint64_t GetDiscardedMeasurements() const;
+
+        // Gets the total number of frames (i.e., timestamps) published.
+        uint64_t GetPublishedFrames() const;
+
+        // Gets or sets user defined data reference.
+        void* GetUserData() const;
+        void SetUserData(void* userData);
+
+        // Registers the callback that receives the device frames published for each timestamp.
+        void RegisterNewFramesCallback(const NewFramesCallback& newFramesCallback);
+    };
+}}}
+
+#endif
@@ -0,0 +1,205 @@
+//******************************************************************************************************
+//  FrameConcentrator.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FrameConcentrator.h"
+#include "../Common/Convert.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+ConcentratedFrame::ConcentratedFrame() :
+    Timestamp(0)
+{
+}
+
+FrameConcentrator::FrameConcentrator(uint32_t framesPerSecond, float64_t lagTime, float64_t leadTime, bool useLocalClockAsRealTime) :
+    m_frameAligner([this](FrameSlot& frameSlot) { PublishFrameSlot(frameSlot); }, framesPerSecond, lagTime, leadTime, useLocalClockAsRealTime),
+    m_newFrameCallback(nullptr),
+    m_userData(nullptr)
+{
+}
+
+static const Measurement& GetMeasurement(const Measurement& measurement)
+{
+    return measurement;
+}
+
+static const Measurement& GetMeasurement(const MeasurementPtr& measurement)
+{
+    return *measurement;
+}
+
+template<typename T>
+void FrameConcentrator::AddMeasurementsImpl(const vector<T>& measurements, const SignalIndexCache& signalIndexCache)
+{
+    ScopeLock lock(m_frameLock);
+
+    const int64_t localClock = ToTicks(UtcNow());
+    int64_t realTime = m_frameAligner.GetRealTime(localClock);
+
+    for (size_t i = 0; i < measurements.size(); i++)
+    {
+        const Measurement& measurement = GetMeasurement(measurements[i]);
+        const uint16_t runtimeID = signalIndexCache.GetSignalIndex(measurement.SignalID);
+
+        if (runtimeID == UInt16::MaxValue)
+            continue;
+
+        const int64_t timestamp = RoundToFrame(measurement.Timestamp);
+
+        if (!m_frameAligner.TryAccept(measurement.Timestamp, timestamp, localClock, realTime))
+            continue;
+
+        FrameSlot& frameSlot = m_frameAligner.GetSlot(timestamp);
+        ConcentratedFrame& frame = frameSlot.Frame;
+
+        if (runtimeID >= frameSlot.Positions.size())
+            frameSlot.Positions.resize(runtimeID + 1, -1);
+
+        int32_t& position = frameSlot.Positions[runtimeID];
+
+        if (position < 0)
+        {
+            // First measurement for signal in this frame
+            position = static_cast<int32_t>(frame.Measurements.size());
+            frame.Measurements.push_back(measurement);
+            frame.RuntimeIDs.push_back(runtimeID);
+        }
+        else
+        {
+            // Keep latest measurement for signal
+            frame.Measurements[position] = measurement;
+        }
+    }
+
+    m_frameAligner.Advance(realTime);
+}
+
+// Rounds a timestamp to the nearest frame, frames are evenly distributed within each second.
+int64_t FrameConcentrator::RoundToFrame(int64_t timestamp) const
+{
+    const int64_t framesPerSecond = m_frameAligner.GetFramesPerSecond();
+    const int64_t baseTicks = timestamp - timestamp % Ticks::PerSecond;
+    const int64_t frameIndex = ((timestamp - baseTicks) * framesPerSecond + Ticks::PerSecond / 2) / Ticks::PerSecond;
+
+    return baseTicks + frameIndex * Ticks::PerSecond / framesPerSecond;
+}
+
+// Clears a frame slot for reuse, buffers keep their capacity.
+void FrameConcentrator::FrameSlot::Clear()
+{
+    // Only positions of signals present in the frame need to be reset
+    for (const uint16_t runtimeID : Frame.RuntimeIDs)
+        Positions[runtimeID] = -1;
+
+    Frame.Measurements.clear();
+    Frame.RuntimeIDs.clear();
+}
+
+void FrameConcentrator::PublishFrameSlot(FrameSlot& frameSlot)
+{
+    frameSlot.Frame.Timestamp = frameSlot.Timestamp;
+
+    if (m_newFrameCallback != nullptr)
+        m_newFrameCallback(this, frameSlot.Frame);
+}
+
+uint32_t FrameConcentrator::GetFramesPerSecond() const
+{
+    return m_frameAligner.GetFramesPerSecond();
+}
+
+int32_t FrameConcentrator::GetFrameInterval() const
+{
+    return m_frameAligner.GetFrameInterval();
+}
+
+float64_t FrameConcentrator::GetLagTime() const
+{
+    return m_frameAligner.GetLagTime();
+}
+
+float64_t FrameConcentrator::GetLeadTime() const
+{
+    return m_frameAligner.GetLeadTime();
+}
+
+bool FrameConcentrator::GetUseLocalClockAsRealTime() const
+{
+    return m_frameAligner.GetUseLocalClockAsRealTime();
+}
+
+void FrameConcentrator::AddMeasurements(const vector<Measurement>& measurements, const SignalIndexCache& signalIndexCache)
+{
+    AddMeasurementsImpl(measurements, signalIndexCache);
+}
+
+void FrameConcentrator::AddMeasurements(const vector<MeasurementPtr>& measurements, const SignalIndexCache& signalIndexCache)
+{
+    AddMeasurementsImpl(measurements, signalIndexCache);
+}
+
+void FrameConcentrator::PublishReadyFrames()
+{
+    ScopeLock lock(m_frameLock);
+    m_frameAligner.PublishReadyFrames();
+}
+
+void FrameConcentrator::Flush()
+{
+    ScopeLock lock(m_frameLock);
+    m_frameAligner.Flush();
+}
+
+void FrameConcentrator::Reset()
+{
+    ScopeLock lock(m_frameLock);
+    m_frameAligner.Reset();
+}
+
+uint64_t FrameConcentrator::GetDiscardedMeasurements() const
+{
+    return m_frameAligner.GetDiscardedMeasurements();
+}
+
+uint64_t FrameConcentrator::GetPublishedFrames() const
+{
+    return m_frameAligner.GetPublishedFrames();
+}
+
+void* FrameConcentrator::GetUserData() const
+{
+    return m_userData;
+}
+
+void FrameConcentrator::SetUserData(void* userData)
+{
+    m_userData = userData;
+}
+
+void FrameConcentrator::RegisterNewFrameCallback(const NewFrameCallback& newFrameCallback)
+{
+    m_newFrameCallback = newFrameCallback;
+}
@@ -0,0 +1,139 @@
+//******************************************************************************************************
+//  FrameConcentrator.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FRAME_CONCENTRATOR_H
+#define __FRAME_CONCENTRATOR_H
+
+#include "TransportTypes.h"
+#include "SignalIndexCache.h"
+#include "FrameAligner.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Measurements concentrated into a single frame of time-aligned data.
+    struct ConcentratedFrame
+    {
+        // The frame time, in ticks, i.e., the measurement timestamps rounded to the frame rate.
+        int64_t Timestamp;
+
+        // Latest measurement received for each signal at the frame time.
+        std::vector<Measurement> Measurements;
+
+        // Runtime IDs of the measurements, in the same order.
+        std::vector<uint16_t> RuntimeIDs;
+
+        ConcentratedFrame();
+    };
+
+    // Concentrates published measurements into frames for a synchronized subscription.
+    //
+    // Timestamps are rounded to the nearest frame at the configured frame rate and each frame
+    // holds only the latest measurement of a signal, indexed by its runtime ID in the signal
+    // index cache of the subscription. Lag and lead time handling is that of FrameAligner.
+    //
+    // Frames passed to the new frame callback are only valid for the duration of the callback,
+    // and the callback must not call back into the frame concentrator. When the local clock is
+    // used as real time, PublishReadyFrames should be called at the frame interval.
+    class FrameConcentrator // NOLINT
+    {
+    private:
+        typedef std::function<void(FrameConcentrator*, const ConcentratedFrame&)> NewFrameCallback;
+
+        // Frame along with the position of each runtime ID in the frame, or -1 when not present.
+        struct FrameSlot
+        {
+            int64_t Timestamp;
+            ConcentratedFrame Frame;
+            std::vector<int32_t> Positions;
+
+            void Clear();
+        };
+
+        FrameAligner<FrameSlot> m_frameAligner;
+        Mutex m_frameLock;
+
+        NewFrameCallback m_newFrameCallback;
+        void* m_userData;
+
+        template<typename T>
+        void AddMeasurementsImpl(const std::vector<T>& measurements, const SignalIndexCache& signalIndexCache);
+
+        int64_t RoundToFrame(int64_t timestamp) const;
+        void PublishFrameSlot(FrameSlot& frameSlot);
+
+    public:
+        // Creates a new frame concentrator with the given frame rate, and lag and lead times in seconds.
+        FrameConcentrator(uint32_t framesPerSecond = 30, float64_t lagTime = 10.0, float64_t leadTime = 5.0, bool useLocalClockAsRealTime = false);
+
+        // Gets the number of frames published per second.
+        uint32_t GetFramesPerSecond() const;
+
+        // Gets the time between frames, in milliseconds.
+        int32_t GetFrameInterval() const;
+
+        // Gets the allowed past time deviation tolerance, in seconds.
+        float64_t GetLagTime() const;
+
+        // Gets the allowed future time deviation tolerance, in seconds.
+        float64_t GetLeadTime() const;
+
+        // Gets flag that determines whether the local clock, rather
+        // than the latest received timestamp, is used as real time.
+        bool GetUseLocalClockAsRealTime() const;
+
+        // Sorts the given measurements into frames and publishes any frames that real time has moved
+        // past by more than the lag time. Measurements without a runtime ID in the signal index
+        // cache are ignored.
+        void AddMeasurements(const std::vector<Measurement>& measurements, const SignalIndexCache& signalIndexCache);
+        void AddMeasurements(const std::vector<MeasurementPtr>& measurements, const SignalIndexCache& signalIndexCache);
+
+        // Publishes any frames that are ready for publication according to the local
+        // clock. Useful to keep publishing on time when no data is being received.
+        void PublishReadyFrames();
+
+        // Publishes all pending frames and resets real time.
+        void Flush();
+
+        // Discards all pending frames and resets real time.
+        void Reset();
+
+        // Gets the total number of measurements discarded for arriving outside the lag and lead times.
+        uint64_t GetDiscardedMeasurements() const;
+
+        // Gets the total number of frames published.
+        uint64_t GetPublishedFrames() const;
+
+        // Gets or sets user defined data reference.
+        void* GetUserData() const;
+        void SetUserData(void* userData);
+
+        // Registers the callback that receives each published frame.
+        void RegisterNewFrameCallback(const NewFrameCallback& newFrameCallback);
+    };
+
+    typedef SharedPtr<FrameConcentrator> FrameConcentratorPtr;
+}}}
+
+#endif
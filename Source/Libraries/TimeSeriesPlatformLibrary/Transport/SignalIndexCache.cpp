@@ -33,7 +33,11 @@ using namespace GSF;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+const uint32_t SignalIndexCache::UndefinedSourceIndex;
+const uint16_t SignalIndexCache::EmptySlot;
+
 SignalIndexCache::SignalIndexCache() :
+    m_signalIDSlotsUsed(0),
     m_binaryLength(28)
 {
 }
@@ -41,43 +45,123 @@ SignalIndexCache::SignalIndexCache() :
 // Adds a measurement key to the cache.
 void SignalIndexCache::AddMeasurementKey(const uint16_t signalIndex, const Guid& signalID, const string& source, const uint32_t id, const uint32_t charSizeEstimate)
 {
-    m_reference.insert_or_assign(signalIndex, m_signalIDList.size());
-    m_signalIDList.push_back(signalID);
-    m_sourceList.push_back(source);
-    m_idList.push_back(id);
-    m_signalIDCache.insert_or_assign(signalID, signalIndex);
+    if (signalIndex >= m_records.size())
+        m_records.resize(signalIndex + 1U, { Empty::Guid, UndefinedSourceIndex, 0U });
+
+    SignalIndexRecord& record = m_records[signalIndex];
+
+    if (record.SourceIndex == UndefinedSourceIndex)
+        m_signalIndexes.push_back(signalIndex);
+
+    record.SignalID = signalID;
+    record.SourceIndex = GetSourceIndex(source);
+    record.ID = id;
+
+    // Runtime ID of 0xFFFF is reserved to indicate a failed reverse lookup
+    if (signalIndex != EmptySlot)
+        InsertSignalIDSlot(signalID, signalIndex);
 
     // Char size here helps provide a rough-estimate on binary length used to reserve
     // bytes for a vector, if exact size is needed call RecalculateBinaryLength first
     m_binaryLength += 26 + source.size() * charSizeEstimate;
 }
 
+// Gets the index of the given source in the source list, adding it if
+// needed, so that each distinct source is only stored once per cache.
+uint32_t SignalIndexCache::GetSourceIndex(const string& source)
+{
+    const auto result = m_sourceLookup.find(source);
+
+    if (result != m_sourceLookup.end())
+        return result->second;
+
+    const uint32_t sourceIndex = static_cast<uint32_t>(m_sourceList.size());
+
+    m_sourceList.emplace_back(source);
+    m_sourceLookup.emplace(source, sourceIndex);
+
+    return sourceIndex;
+}
+
+// Maps the signal ID to the runtime ID in the reverse lookup table.
+void SignalIndexCache::InsertSignalIDSlot(const Guid& signalID, const uint16_t signalIndex)
+{
+    // Keep the table at most half full so that probe sequences stay short
+    if ((m_signalIDSlotsUsed + 1U) * 2U > m_signalIDSlots.size())
+        RehashSignalIDSlots(max(16U, static_cast<uint32_t>(m_signalIDSlots.size()) * 2U));
+
+    const size_t mask = m_signalIDSlots.size() - 1;
+    size_t slot = GetSignalIDHash(signalID) & mask;
+
+    while (true)
+    {
+        uint16_t& slotIndex = m_signalIDSlots[slot];
+
+        if (slotIndex == EmptySlot)
+        {
+            slotIndex = signalIndex;
+            m_signalIDSlotsUsed++;
+            return;
+        }
+
+        if (m_records[slotIndex].SignalID == signalID)
+        {
+            slotIndex = signalIndex;
+            return;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+// Rebuilds the reverse lookup table with the given power-of-two capacity.
+void SignalIndexCache::RehashSignalIDSlots(const uint32_t capacity)
+{
+    m_signalIDSlots.assign(capacity, EmptySlot);
+    m_signalIDSlotsUsed = 0;
+
+    for (const uint16_t signalIndex : m_signalIndexes)
+    {
+        if (signalIndex != EmptySlot)
+            InsertSignalIDSlot(m_records[signalIndex].SignalID, signalIndex);
+    }
+}
+
+size_t SignalIndexCache::GetSignalIDHash(const Guid& signalID)
+{
+    uint64_t high, low;
+
+    memcpy(&high, signalID.data, 8);
+    memcpy(&low, signalID.data + 8, 8);
+
+    // Fibonacci hashing spreads sequential as well as random signal IDs
+    return static_cast<size_t>(((high ^ low) * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
 // Empties the cache.
 void SignalIndexCache::Clear()
 {
-    m_reference.clear();
-    m_signalIDList.clear();
+    m_records.clear();
+    m_signalIndexes.clear();
+    m_signalIDSlots.clear();
+    m_signalIDSlotsUsed = 0;
     m_sourceList.clear();
-    m_idList.clear();
-    m_signalIDCache.clear();
+    m_sourceLookup.clear();
 }
 
 // Determines whether an element with the given runtime ID exists in the signal index cache.
 bool SignalIndexCache::Contains(const uint16_t signalIndex) const
 {
-    return m_reference.find(signalIndex) != m_reference.end();
+    return GetRecord(signalIndex) != nullptr;
 }
 
 // Gets the globally unique signal ID associated with the given 16-bit runtime ID.
 Guid SignalIndexCache::GetSignalID(uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const SignalIndexRecord* record = GetRecord(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_signalIDList[vectorIndex];
-    }
+    if (record != nullptr)
+        return record->SignalID;
 
     return Empty::Guid;
 }
@@ -86,13 +170,10 @@ Guid SignalIndexCache::GetSignalID(uint16_t signalIndex) const
 // key associated with the given 16-bit runtime ID.
 const string& SignalIndexCache::GetSource(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const SignalIndexRecord* record = GetRecord(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_sourceList[vectorIndex];
-    }
+    if (record != nullptr)
+        return m_sourceList[record->SourceIndex].ToString();
 
     return Empty::String;
 }
@@ -101,13 +182,10 @@ const string& SignalIndexCache::GetSource(const uint16_t signalIndex) const
 // key associated with the given 16-bit runtime ID.
 uint32_t SignalIndexCache::GetID(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const SignalIndexRecord* record = GetRecord(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_idList[vectorIndex];
-    }
+    if (record != nullptr)
+        return record->ID;
 
     return UInt32::MaxValue;
 }
@@ -116,15 +194,31 @@ uint32_t SignalIndexCache::GetID(const uint16_t signalIndex) const
 // measurement key associated with the given 16-bit runtime ID.
 bool SignalIndexCache::GetMeasurementKey(const uint16_t signalIndex, Guid& signalID, string& source, uint32_t& id) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const SignalIndexRecord* record = GetRecord(signalIndex);
 
-    if (result != m_reference.end())
+    if (record != nullptr)
     {
-        const uint32_t vectorIndex = result->second;
+        signalID = record->SignalID;
+        source = m_sourceList[record->SourceIndex].ToString();
+        id = record->ID;
 
-        signalID = m_signalIDList[vectorIndex];
-        source = m_sourceList[vectorIndex];
-        id = m_idList[vectorIndex];
+        return true;
+    }
+
+    return false;
+}
+
+// Gets the globally unique signal ID as well as the human-readable measurement key
+// associated with the given 16-bit runtime ID, where source shares the cached copy.
+bool SignalIndexCache::GetMeasurementKey(const uint16_t signalIndex, Guid& signalID, MeasurementSource& source, uint32_t& id) const
+{
+    const SignalIndexRecord* record = GetRecord(signalIndex);
+
+    if (record != nullptr)
+    {
+        signalID = record->SignalID;
+        source = m_sourceList[record->SourceIndex];
+        id = record->ID;
 
         return true;
     }
@@ -135,18 +229,50 @@ bool SignalIndexCache::GetMeasurementKey(const uint16_t signalIndex, Guid& signa
 // Gets the 16-bit runtime ID associated with the given globally unique signal ID.
 uint16_t SignalIndexCache::GetSignalIndex(const Guid& signalID) const
 {
-    const auto result = m_signalIDCache.find(signalID);
-    uint16_t signalIndex = UInt16::MaxValue;
+    if (m_signalIDSlots.empty())
+        return UInt16::MaxValue;
 
-    if (result != m_signalIDCache.end())
-        signalIndex = result->second;
+    const size_t mask = m_signalIDSlots.size() - 1;
+    size_t slot = GetSignalIDHash(signalID) & mask;
 
-    return signalIndex;
+    while (true)
+    {
+        const uint16_t signalIndex = m_signalIDSlots[slot];
+
+        if (signalIndex == EmptySlot)
+            return UInt16::MaxValue;
+
+        // Slots left behind by reassigned runtime IDs no longer match and are skipped
+        if (m_records[signalIndex].SignalID == signalID)
+            return signalIndex;
+
+        slot = (slot + 1) & mask;
+    }
 }
 
 uint32_t SignalIndexCache::Count() const
 {
-    return m_signalIDCache.size();
+    return static_cast<uint32_t>(m_signalIndexes.size());
+}
+
+bool SignalIndexCache::Equals(const SignalIndexCache& other) const
+{
+    if (m_signalIndexes.size() != other.m_signalIndexes.size())
+        return false;
+
+    for (const uint16_t signalIndex : m_signalIndexes)
+    {
+        const SignalIndexRecord& record = m_records[signalIndex];
+        const SignalIndexRecord* otherRecord = other.GetRecord(signalIndex);
+
+        if (otherRecord == nullptr || otherRecord->SignalID != record.SignalID || otherRecord->ID != record.ID)
+            return false;
+
+        if (other.m_sourceList[otherRecord->SourceIndex].ToString() != m_sourceList[record.SourceIndex].ToString())
+            return false;
+    }
+
+    return true;
 }
 
 uint32_t SignalIndexCache::GetBinaryLength() const
@@ -158,8 +284,8 @@ void SignalIndexCache::RecalculateBinaryLength(const SubscriberConnectionPtr& co
 {
     uint32_t binaryLength = 28;
 
-    for (size_t i = 0; i < m_signalIDList.size(); i++)
-        binaryLength += 26 + DataPublisher::EncodeClientString(connection, m_sourceList[i]).size();
+    for (const uint16_t signalIndex : m_signalIndexes)
+        binaryLength += 26 + DataPublisher::EncodeClientString(connection, m_sourceList[m_records[signalIndex].SourceIndex].ToString()).size();
 
     m_binaryLength = binaryLength;
 }
@@ -167,7 +293,6 @@ void SignalIndexCache::RecalculateBinaryLength(const SubscriberConnectionPtr& co
 void SignalIndexCache::Parse(const vector<uint8_t>& buffer, Guid& subscriberID)
 {
     const uint8_t* data = buffer.data();
-    stringstream sourceStream;
 
     // Skip 4-byte length and parse subscriber ID
     subscriberID = ParseGuid(data + 4);
@@ -191,23 +316,17 @@ void SignalIndexCache::Parse(const vector<uint8_t>& buffer, Guid& subscriberID)
         const char* sourcePtr = reinterpret_cast<const char*>(sourceSizePtr + 1);
         const uint32_t* idPtr = reinterpret_cast<const uint32_t*>(sourcePtr + sourceSize);
 
-        // Build string from binary data -- NOTE: this presumes subscriber code is always UTF8
-        for (const char* sourceIter = sourcePtr; sourceIter < sourcePtr + sourceSize; ++sourceIter)
-            sourceStream << *sourceIter;
-
-        // Set values for measurement key
+        // Set values for measurement key -- NOTE: this presumes subscriber code is always UTF8
         const uint16_t signalIndex = EndianConverter::Default.ConvertBigEndian(*signalIndexPtr);
         const Guid signalID = ParseGuid(signalIDPtr, true, true);
-        const string source = sourceStream.str();
+        const string source(sourcePtr, sourceSize);
         const uint32_t id = EndianConverter::Default.ConvertBigEndian(*idPtr);
 
         // Add measurement key to the cache
         AddMeasurementKey(signalIndex, signalID, source, id);
 
-        // Advance signalIndexPtr to the next signal
-        // index and clear out the string stream
+        // Advance signalIndexPtr to the next signal index
         signalIndexPtr = reinterpret_cast<const uint16_t*>(idPtr + 1);
-        sourceStream.str("");
     }
 
     // There is additional data about unauthorized signal
@@ -228,26 +347,27 @@ void SignalIndexCache::Serialize(const SubscriberConnectionPtr& connection, vect
     WriteBytes(buffer, subscriberID);
 
     // Encode number of references
-    EndianConverter::WriteBigEndianBytes(buffer, int32_t(m_reference.size()));
+    EndianConverter::WriteBigEndianBytes(buffer, int32_t(m_signalIndexes.size()));
 
-    for (size_t i = 0; i < m_signalIDList.size(); i++)
+    for (const uint16_t signalIndex : m_signalIndexes)
     {
-        Guid signalID = m_signalIDList[i];
+        const SignalIndexRecord& record = m_records[signalIndex];
+        Guid signalID = record.SignalID;
 
         // Encode run-time signal index
-        EndianConverter::WriteBigEndianBytes(buffer, GetSignalIndex(signalID));
+        EndianConverter::WriteBigEndianBytes(buffer, signalIndex);
 
         // Encode signal ID
         SwapGuidEndianness(signalID, true);
         WriteBytes(buffer, signalID);
 
         // Encode source
-        vector<uint8_t> sourceBytes = DataPublisher::EncodeClientString(connection, m_sourceList[i]);
+        vector<uint8_t> sourceBytes = DataPublisher::EncodeClientString(connection, m_sourceList[record.SourceIndex].ToString());
         EndianConverter::WriteBigEndianBytes(buffer, int32_t(sourceBytes.size()));
         WriteBytes(buffer, sourceBytes);
 
         // Encode ID
-        EndianConverter::WriteBigEndianBytes(buffer, m_idList[i]);
+        EndianConverter::WriteBigEndianBytes(buffer, record.ID);
 
         // Update binary length
         binaryLength += 26 + sourceBytes.size();
@@ -27,6 +27,7 @@
 #define __SIGNAL_INDEX_CACHE_H
 
 #include "../Common/CommonTypes.h"
+#include "TransportTypes.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -35,19 +36,46 @@ namespace Transport
     class SubscriberConnection;
     typedef SharedPtr<SubscriberConnection> SubscriberConnectionPtr;
 
+    // Compact record of the measurement key assigned to a 16-bit runtime ID.
+    struct SignalIndexRecord
+    {
+        // Measurement's globally unique identifier.
+        GSF::Guid SignalID;
+
+        // Index of the measurement key source in the cache's source list.
+        uint32_t SourceIndex;
+
+        // Numeric half of the measurement key.
+        uint32_t ID;
+    };
+
     // Maps 16-bit runtime IDs to 128-bit globally unique IDs.
     // Additionally provides reverse lookup and an extra mapping
     // to human-readable measurement keys.
+    //
+    // Runtime IDs are assigned densely from zero, so records are held in a
+    // table indexed directly by runtime ID. Reverse lookups use an open
+    // addressed hash table of runtime IDs keyed by the records' signal IDs.
     class SignalIndexCache
     {
     private:
-        std::unordered_map<uint16_t, uint32_t> m_reference;
-        std::vector<GSF::Guid> m_signalIDList;
-        std::vector<std::string> m_sourceList;
-        std::vector<uint32_t> m_idList;
-        std::unordered_map<GSF::Guid, uint16_t> m_signalIDCache;
+        static const uint32_t UndefinedSourceIndex = 0xFFFFFFFFU;
+        static const uint16_t EmptySlot = 0xFFFFU;
+
+        std::vector<SignalIndexRecord> m_records;
+        std::vector<uint16_t> m_signalIndexes;
+        std::vector<uint16_t> m_signalIDSlots;
+        uint32_t m_signalIDSlotsUsed;
+        std::vector<MeasurementSource> m_sourceList;
+        std::unordered_map<std::string, uint32_t> m_sourceLookup;
         uint32_t m_binaryLength;
 
+        uint32_t GetSourceIndex(const std::string& source);
+        void InsertSignalIDSlot(const GSF::Guid& signalID, uint16_t signalIndex);
+        void RehashSignalIDSlots(uint32_t capacity);
+
+        static size_t GetSignalIDHash(const GSF::Guid& signalID);
+
     public:
         SignalIndexCache();
 
@@ -60,6 +88,17 @@ namespace Transport
         // Determines whether an element with the given runtime ID exists in the signal index cache.
         bool Contains(uint16_t signalIndex) const;
 
+        // Gets the record associated with the given 16-bit runtime ID,
+        // or nullptr if the runtime ID is not defined in the cache.
+        const SignalIndexRecord* GetRecord(uint16_t signalIndex) const
+        {
+            if (signalIndex >= m_records.size())
+                return nullptr;
+
+            const SignalIndexRecord& record = m_records[signalIndex];
+            return record.SourceIndex == UndefinedSourceIndex ? nullptr : &record;
+        }
+
         // Gets the globally unique signal ID associated with the given 16-bit runtime ID.
         GSF::Guid GetSignalID(uint16_t signalIndex) const;
 
@@ -75,12 +114,20 @@ namespace Transport
         // measurement key associated with the given 16-bit runtime ID.
         bool GetMeasurementKey(uint16_t signalIndex, GSF::Guid& signalID, std::string& source, uint32_t& id) const;
 
+        // Gets the globally unique signal ID as well as the human-readable measurement key
+        // associated with the given 16-bit runtime ID, where source shares the cached copy.
+        bool GetMeasurementKey(uint16_t signalIndex, GSF::Guid& signalID, MeasurementSource& source, uint32_t& id) const;
+
         // Gets the 16-bit runtime ID associated with the given globally unique signal ID.
         uint16_t GetSignalIndex(const GSF::Guid& signalID) const;
 
         // Gets the mapped signal count
         uint32_t Count() const;
 
+        // Determines whether the other cache maps exactly the same runtime IDs to the same
+        // signal IDs and measurement keys, in which case measurements serialize identically.
+        bool Equals(const SignalIndexCache& other) const;
+
         // Gets an estimated binary size of a serialized signal index cache useful for pre-allocating
         // a vector size, for an exact size call RecalculateBinaryLength first
         uint32_t GetBinaryLength() const;
@@ -26,6 +26,8 @@
 #include "CompactMeasurement.h"
 #include "../Common/Convert.h"
 #include "../Common/EndianConverter.h"
+#include <cmath>
+#include <cstring>
 
 using namespace std;
 using namespace boost::asio;
@@ -35,6 +37,31 @@ using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
 static const uint32_t MaxPacketSize = 32768U;
+static const uint8_t TSSCVersion = 85;
+
+// Size of the data packet headers that follow the response headers: flags and measurement count
+static const uint32_t CompactDataPacketHeaderSize = 5;
+
+// Size of the synchronized data packet headers: flags, frame timestamp and measurement count
+static const uint32_t SynchronizedDataPacketHeaderSize = 13;
+
+// Size of the TSSC data packet headers: flags, measurement count, TSSC version and sequence number
+static const uint32_t TSSCDataPacketHeaderSize = 8;
+
+// Largest serialized compact measurement: flags, runtime ID, value and full timestamp
+static const uint32_t MaxCompactMeasurementSize = 15;
+
+// Maximum number of queued responses gathered into a single command channel write
+static const size_t MaxResponsesPerWrite = 64;
+
+// Size, in bytes, of the AES-256 keys used to encrypt data packets
+static const uint32_t CipherKeySize = 32;
+
+// Determines whether the value of a measurement, as it would be published, is NaN.
+static bool IsNaNValue(const Measurement& measurement)
+{
+    return std::isnan(measurement.AdjustedValue());
+}
 
 SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& commandChannelService, IOContext& dataChannelService) :
     m_parent(std::move(parent)),
@@ -47,21 +74,43 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
     m_includeTime(true),
     m_useMillisecondResolution(false), // Defaults to microsecond resolution
     m_isNaNFiltered(false),
+    m_trackLatestMeasurements(false),
+    m_lagTime(10.0),
+    m_processingInterval(-1),
     m_isSubscribed(false),
     m_startTimeSent(false),
     m_stopped(true),
     m_commandChannelSocket(m_commandChannelService),
     m_readBuffer(Common::MaxPacketSize),
+    m_sending(false),
+    m_disconnectRequested(false),
+    m_peakSendQueueDepth(0),
+    m_totalDataPacketsDropped(0L),
     m_udpPort(0),
     m_dataChannelSocket(dataChannelService),
+    m_cipherIndex(0),
+    m_cipherKeysDefined(false),
     m_timeIndex(0),
-    m_baseTimeOffsets{0L, 0L}
+    m_baseTimeOffsets{0L, 0L},
+    m_tsscResetRequested(true),
+    m_tsscSequenceNumber(0)
 {
     // Setup ping timer
     m_pingTimer.SetInterval(5000);
     m_pingTimer.SetAutoReset(true);
     m_pingTimer.SetCallback(&SubscriberConnection::PingTimerElapsed);
     m_pingTimer.SetUserData(this);
+
+    // Setup throttled publication timer
+    m_throttledPublicationTimer.SetInterval(GetThrottledPublicationInterval());
+    m_throttledPublicationTimer.SetAutoReset(true);
+    m_throttledPublicationTimer.SetCallback(&SubscriberConnection::ThrottledPublicationTimerElapsed);
+    m_throttledPublicationTimer.SetUserData(this);
+
+    // Setup frame publication timer, interval is set by the frame rate of each subscription
+    m_framePublicationTimer.SetAutoReset(true);
+    m_framePublicationTimer.SetCallback(&SubscriberConnection::FramePublicationTimerElapsed);
+    m_framePublicationTimer.SetUserData(this);
 }
 
 SubscriberConnection::~SubscriberConnection() = default;
@@ -167,6 +216,47 @@ void SubscriberConnection::SetIsNaNFiltered(bool value)
     m_isNaNFiltered = value;
 }
 
+bool SubscriberConnection::GetTrackLatestMeasurements() const
+{
+    return m_trackLatestMeasurements;
+}
+
+void SubscriberConnection::SetTrackLatestMeasurements(bool value)
+{
+    m_trackLatestMeasurements = value;
+}
+
+float64_t SubscriberConnection::GetLagTime() const
+{
+    return m_lagTime;
+}
+
+void SubscriberConnection::SetLagTime(float64_t value)
+{
+    m_lagTime = value;
+    m_throttledPublicationTimer.SetInterval(GetThrottledPublicationInterval());
+}
+
+int32_t SubscriberConnection::GetProcessingInterval() const
+{
+    return m_processingInterval;
+}
+
+void SubscriberConnection::SetProcessingInterval(int32_t value)
+{
+    // New interval takes effect at the next throttled publication
+    m_processingInterval = value;
+    m_throttledPublicationTimer.SetInterval(GetThrottledPublicationInterval());
+}
+
+int32_t SubscriberConnection::GetThrottledPublicationInterval() const
+{
+    if (m_processingInterval > 0)
+        return m_processingInterval;
+
+    return max(static_cast<int32_t>(m_lagTime * 1000.0), 1);
+}
+
 bool SubscriberConnection::GetIsSubscribed() const
 {
     return m_isSubscribed;
@@ -175,6 +265,33 @@ bool SubscriberConnection::GetIsSubscribed() const
 void SubscriberConnection::SetIsSubscribed(bool value)
 {
     m_isSubscribed = value;
+
+    // Subscriber resets its TSSC decoder on each successful
+    // subscription, so encoder must start over as well
+    if (value)
+    {
+        ScopeLock lock(m_tsscLock);
+        m_tsscResetRequested = true;
+    }
+
+    // Latest measurements are tracked per subscription, runtime IDs may change
+    ClearLatestMeasurements();
+
+    if (value && m_trackLatestMeasurements)
+        m_throttledPublicationTimer.Start();
+    else
+        m_throttledPublicationTimer.Stop();
+
+    // Frames timed by the local clock are published at the frame rate whether or not data arrives
+    if (value && m_frameConcentrator != nullptr && m_frameConcentrator->GetUseLocalClockAsRealTime())
+    {
+        m_framePublicationTimer.SetInterval(m_frameConcentrator->GetFrameInterval());
+        m_framePublicationTimer.Start();
+    }
+    else
+    {
+        m_framePublicationTimer.Stop();
+    }
 }
 
 const string& SubscriberConnection::GetSubscriptionInfo() const
@@ -219,9 +336,73 @@ void SubscriberConnection::SetSignalIndexCache(SignalIndexCachePtr signalIndexCa
     m_signalIndexCache = std::move(signalIndexCache);
 }
 
+const FrameConcentratorPtr& SubscriberConnection::GetFrameConcentrator() const
+{
+    return m_frameConcentrator;
+}
+
+void SubscriberConnection::SetFrameConcentrator(FrameConcentratorPtr frameConcentrator)
+{
+    if (frameConcentrator != nullptr)
+    {
+        frameConcentrator->SetUserData(this);
+        frameConcentrator->RegisterNewFrameCallback(&SubscriberConnection::FrameConcentratorNewFrame);
+    }
+
+    m_frameConcentrator = std::move(frameConcentrator);
+}
+
+void SubscriberConnection::OpenDataChannel(uint16_t port, ErrorCode& error)
+{
+    error.clear();
+
+    if (port == m_udpPort && (port == 0 || m_dataChannelSocket.is_open()))
+        return;
+
+    if (m_dataChannelSocket.is_open())
+    {
+        ErrorCode closeError;
+        m_dataChannelSocket.close(closeError);
+    }
+
+    m_udpPort = 0;
+
+    if (port == 0)
+        return;
+
+    // Send from the same interface the client used to connect to the command channel
+    const IPAddress localAddress = m_commandChannelSocket.local_endpoint(error).address();
+
+    if (!error)
+        m_dataChannelSocket.open(localAddress.is_v6() ? udp::v6() : udp::v4(), error);
+
+    if (!error)
+        m_dataChannelSocket.bind(UdpEndPoint(localAddress, 0), error);
+
+    if (error)
+    {
+        ErrorCode closeError;
+        m_dataChannelSocket.close(closeError);
+        return;
+    }
+
+    m_dataChannelEndPoint = UdpEndPoint(m_ipAddress, port);
+    m_udpPort = port;
+}
+
+bool SubscriberConnection::DataChannelDefined() const
+{
+    return m_dataChannelSocket.is_open();
+}
+
+uint16_t SubscriberConnection::GetDataChannelPort() const
+{
+    return m_udpPort;
+}
+
 bool SubscriberConnection::CipherKeysDefined() const
 {
-    return !m_keys[0].empty();
+    return m_cipherKeysDefined;
 }
 
 vector<uint8_t> SubscriberConnection::Keys(int32_t cipherIndex)
@@ -229,6 +410,7 @@ vector<uint8_t> SubscriberConnection::Keys(int32_t cipherIndex)
     if (cipherIndex < 0 || cipherIndex > 1)
         throw out_of_range("Cipher index must be 0 or 1");
 
+    ScopeLock lock(m_cipherLock);
     return m_keys[cipherIndex];
 }
 
@@ -237,9 +419,102 @@ vector<uint8_t> SubscriberConnection::IVs(int32_t cipherIndex)
     if (cipherIndex < 0 || cipherIndex > 1)
         throw out_of_range("Cipher index must be 0 or 1");
 
+    ScopeLock lock(m_cipherLock);
     return m_ivs[cipherIndex];
 }
 
+int32_t SubscriberConnection::GetCipherIndex()
+{
+    ScopeLock lock(m_cipherLock);
+    return m_cipherIndex;
+}
+
+void SubscriberConnection::RotateCipherKeys()
+{
+    vector<uint8_t> buffer;
+
+    {
+        ScopeLock lock(m_cipherLock);
+
+        if (m_cipherKeysDefined)
+        {
+            // Publication switches to the key set sent on the previous rotation, which the subscriber
+            // already has, so only the retired key set is replaced with new keys
+            const int32_t retiredIndex = m_cipherIndex;
+            m_cipherIndex ^= 1;
+            GenerateCipherKeys(retiredIndex);
+        }
+        else
+        {
+            GenerateCipherKeys(0);
+            GenerateCipherKeys(1);
+            m_cipherIndex = 0;
+        }
+
+        // Serialize active cipher index followed by even and odd key sets
+        buffer.reserve(1 + 2 * (8 + CipherKeySize + AesCipher::BlockSize));
+        buffer.push_back(static_cast<uint8_t>(m_cipherIndex));
+
+        for (int32_t i = 0; i < 2; i++)
+        {
+            EndianConverter::WriteBigEndianBytes(buffer, static_cast<int32_t>(m_keys[i].size()));
+            buffer.insert(buffer.end(), m_keys[i].begin(), m_keys[i].end());
+            EndianConverter::WriteBigEndianBytes(buffer, static_cast<int32_t>(m_ivs[i].size()));
+            buffer.insert(buffer.end(), m_ivs[i].begin(), m_ivs[i].end());
+        }
+    }
+
+    // Keys are queued on the command channel ahead of any data packets encrypted with them
+    if (m_parent->SendClientResponse(shared_from_this(), ServerResponse::UpdateCipherKeys, ServerCommand::RotateCipherKeys, buffer))
+        m_cipherKeysDefined = true;
+}
+
+// Creates a new random key and initialization vector for the given cipher index.
+// Expects m_cipherLock to be held.
+void SubscriberConnection::GenerateCipherKeys(int32_t cipherIndex)
+{
+    vector<uint8_t>& key = m_keys[cipherIndex];
+    vector<uint8_t>& iv = m_ivs[cipherIndex];
+    uint8_t material[CipherKeySize + AesCipher::BlockSize];
+
+    // Key and IV come from a single draw of the cryptographic generator
+    AesCipher::GenerateRandomBytes(material, sizeof(material));
+
+    key.assign(material, material + CipherKeySize);
+    iv.assign(material + CipherKeySize, material + sizeof(material));
+    memset(material, 0, sizeof(material));
+
+    m_ciphers[cipherIndex].SetKey(key.data(), CipherKeySize);
+}
+
+BufferPtr SubscriberConnection::EncryptDataPacket(const vector<uint8_t>& response)
+{
+    const uint32_t payloadOffset = DataPublisher::ClientResponseHeaderSize + 1;
+
+    if (response.size() < payloadOffset)
+    {
+        const BufferPtr packet = m_dataPacketBufferPool.Acquire(static_cast<uint32_t>(response.size()));
+        copy(response.begin(), response.end(), packet->begin());
+        return packet;
+    }
+
+    const uint32_t length = static_cast<uint32_t>(response.size()) - payloadOffset;
+
+    // Pooled buffers keep their capacity, so room for the padding is only allocated until the pool is warm
+    const BufferPtr encryptedResponse = m_dataPacketBufferPool.Acquire(payloadOffset + AesCipher::GetEncryptedLength(length));
+    copy(response.begin(), response.end(), encryptedResponse->begin());
+
+    ScopeLock lock(m_cipherLock);
+
+    m_ciphers[m_cipherIndex].Encrypt(encryptedResponse->data() + payloadOffset, length, m_ivs[m_cipherIndex].data());
+
+    // Encode the active cipher index into the data packet flags
+    if (m_cipherIndex > 0)
+        (*encryptedResponse)[payloadOffset - 1] |= DataPacketFlags::CipherIndex;
+
+    return encryptedResponse;
+}
+
 void SubscriberConnection::Start()
 {
     // Attempt to lookup remote connection identification for logging purposes
@@ -287,118 +562,489 @@ void SubscriberConnection::Stop()
 {
     m_stopped = true;
     m_pingTimer.Stop();
+    m_throttledPublicationTimer.Stop();
+    m_framePublicationTimer.Stop();
+
+    m_sendQueueLock.lock();
+    m_sendQueue.clear();
+    m_sendQueueLock.unlock();
+
     m_commandChannelSocket.shutdown(socket_base::shutdown_both);
     m_commandChannelSocket.cancel();
+
+    if (m_dataChannelSocket.is_open())
+    {
+        ErrorCode error;
+        m_dataChannelSocket.close(error);
+    }
+
     m_parent->RemoveConnection(shared_from_this());
 }
 
 void SubscriberConnection::PublishMeasurements(const vector<Measurement>& measurements)
 {
-    if (measurements.empty() || !m_isSubscribed)
+    if (measurements.empty() || !m_isSubscribed || m_signalIndexCache == nullptr)
+        return;
+
+    if (m_trackLatestMeasurements)
+        UpdateLatestMeasurements(measurements);
+    else
+        PublishMeasurementsImpl(measurements);
+}
+
+void SubscriberConnection::PublishMeasurements(const vector<MeasurementPtr>& measurements)
+{
+    if (measurements.empty() || !m_isSubscribed || m_signalIndexCache == nullptr)
         return;
 
+    if (m_trackLatestMeasurements)
+        UpdateLatestMeasurements(measurements);
+    else
+        PublishMeasurementsImpl(measurements);
+}
+
+bool SubscriberConnection::UsingTSSC() const
+{
+    return m_usePayloadCompression && (m_operationalModes & CompressionModes::TSSC) > 0;
+}
+
+// Prepares the TSSC encoder for a new set of measurements, resetting
+// its state if a reset has been requested. Expects m_tsscLock to be held.
+void SubscriberConnection::BeginTSSCPublication()
+{
+    if (m_tsscResetRequested)
+    {
+        m_tsscResetRequested = false;
+        m_tsscEncoder.Reset();
+
+        m_parent->DispatchStatusMessage("TSSC algorithm reset before sequence number: " + ToString(m_tsscSequenceNumber));
+        m_tsscSequenceNumber = 0;
+    }
+
+    BeginTSSCDataPacket();
+}
+
+// Points the encoder at a response buffer with room reserved for the response and data packet
+// headers, so encoded measurements are sent without being copied. A response buffer that was
+// not published, i.e., no measurements were encoded, is reused. Expects m_tsscLock to be held.
+void SubscriberConnection::BeginTSSCDataPacket()
+{
+    const uint32_t HeaderSize = DataPublisher::ClientResponseHeaderSize + TSSCDataPacketHeaderSize;
+
+    if (m_tsscResponse == nullptr)
+        m_tsscResponse = NewSharedPtr<vector<uint8_t>>(HeaderSize + MaxPacketSize);
+
+    m_tsscEncoder.SetBuffer(m_tsscResponse->data(), HeaderSize, MaxPacketSize);
+}
+
+// Expects m_tsscLock to be held.
+void SubscriberConnection::PublishTSSCMeasurement(const Measurement& measurement, int32_t& count)
+{
+    if (m_isNaNFiltered && IsNaNValue(measurement))
+        return;
+
+    const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+
+    if (runtimeID == UInt16::MaxValue)
+        return;
+
+    const float32_t value = static_cast<float32_t>(measurement.AdjustedValue());
+
+    if (!m_tsscEncoder.TryAddMeasurement(runtimeID, measurement.Timestamp, measurement.Flags, value))
+    {
+        PublishTSSCDataPacket(count);
+        count = 0;
+
+        // Encoder state carries over into the next packet and only the buffer is restarted, unless
+        // publishing the packet dropped queued data packets, then the encoder and sequence restart
+        BeginTSSCPublication();
+
+        // This will always succeed on an empty buffer
+        m_tsscEncoder.TryAddMeasurement(runtimeID, measurement.Timestamp, measurement.Flags, value);
+    }
+
+    count++;
+}
+
+// Expects m_tsscLock to be held.
+void SubscriberConnection::PublishTSSCDataPacket(int32_t count)
+{
+    // Encoded measurements end at the final encoder position
+    const BufferPtr response = m_tsscResponse;
+    response->resize(m_tsscEncoder.FinishBlock());
+    m_tsscResponse = nullptr;
+
+    uint8_t* header = response->data() + DataPublisher::ClientResponseHeaderSize;
+
+    // Serialize data packet flags into response
+    header[0] = DataPacketFlags::Compressed;
+
+    // Serialize total number of measurement values to follow
+    EndianConverter::WriteBigEndianBytes(header + 1, count);
+
+    // Serialize TSSC version and sequence number
+    header[5] = TSSCVersion;
+    EndianConverter::WriteBigEndianBytes(header + 6, m_tsscSequenceNumber);
+
+    m_tsscSequenceNumber++;
+
+    // Do not increment to 0 on roll-over
+    if (m_tsscSequenceNumber == 0)
+        m_tsscSequenceNumber = 1;
+
+    DataPublisher::WriteClientResponseHeader(ServerResponse::DataPacket, ServerCommand::Subscribe, *response);
+
+    // Publish data packet to client
+    m_parent->SendClientResponse(shared_from_this(), ServerResponse::DataPacket, response);
+
+    // Track last publication time
+    m_lastPublishTime = UtcNow();
+}
+
+// Gets the measurement referenced by an element of a measurement vector.
+static const Measurement& GetMeasurement(const Measurement& measurement)
+{
+    return measurement;
+}
+
+static const Measurement& GetMeasurement(const MeasurementPtr& measurement)
+{
+    return *measurement;
+}
+
+template<typename T>
+void SubscriberConnection::PublishMeasurementsImpl(const vector<T>& measurements)
+{
+    const int64_t timestamp = GetMeasurement(measurements[0]).Timestamp;
+
     if (!m_startTimeSent)
-        m_startTimeSent = SendDataStartTime(measurements[0].Timestamp);
+        m_startTimeSent = SendDataStartTime(timestamp);
 
-    // TODO: Consider queuing measurements for processing
+    if (m_frameConcentrator != nullptr)
+    {
+        m_frameConcentrator->AddMeasurements(measurements, *m_signalIndexCache);
+        return;
+    }
 
-    CompactMeasurement serializer(m_signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useCompactMeasurementFormat);
-    vector<uint8_t> packet, buffer;
-    int32_t count = 0;
+    if (UsingTSSC())
+    {
+        ScopeLock lock(m_tsscLock);
+        int32_t count = 0;
+
+        BeginTSSCPublication();
+
+        for (size_t i = 0; i < measurements.size(); i++)
+            PublishTSSCMeasurement(GetMeasurement(measurements[i]), count);
+
+        if (count > 0)
+            PublishTSSCDataPacket(count);
 
-    packet.reserve(MaxPacketSize);
-    buffer.reserve(16);
+        return;
+    }
+
+    vector<BufferPtr> responses;
+
+    SerializeDataPackets(measurements, responses);
+    PublishDataPackets(responses, timestamp);
+}
+
+// Keeps the newest measurement of each signal in its runtime ID slot until the next throttled publication.
+template<typename T>
+void SubscriberConnection::UpdateLatestMeasurements(const vector<T>& measurements)
+{
+    ScopeLock lock(m_latestMeasurementsLock);
 
     for (size_t i = 0; i < measurements.size(); i++)
     {
-        const Measurement& measurement = measurements[i];
-        const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+        const Measurement& measurement = GetMeasurement(measurements[i]);
 
-        if (runtimeID == UInt16::MaxValue)
+        // Filtered NaN values must not replace the latest published value
+        if (m_isNaNFiltered && IsNaNValue(measurement))
+            continue;
+
+        const uint16_t signalIndex = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+
+        if (signalIndex == UInt16::MaxValue)
             continue;
 
-        const uint32_t length = serializer.SerializeMeasurement(measurement, buffer, runtimeID);
+        if (signalIndex >= m_latestMeasurements.size())
+            m_latestMeasurements.resize(static_cast<size_t>(signalIndex) + 1, LatestMeasurement { Measurement(), false });
+
+        LatestMeasurement& latestMeasurement = m_latestMeasurements[signalIndex];
 
-        if (packet.size() + length > MaxPacketSize)
+        if (latestMeasurement.Updated)
         {
-            PublishDataPacket(packet, count);
-            packet.clear();
-            count = 0;
+            if (measurement.Timestamp < latestMeasurement.Value.Timestamp)
+                continue;
+        }
+        else
+        {
+            m_updatedSignalIndexes.push_back(signalIndex);
+            latestMeasurement.Updated = true;
         }
 
-        WriteBytes(packet, buffer);
-        buffer.clear();
-        count++;
+        latestMeasurement.Value = measurement;
     }
+}
 
-    if (count > 0)
-        PublishDataPacket(packet, count);
+void SubscriberConnection::ClearLatestMeasurements()
+{
+    ScopeLock lock(m_latestMeasurementsLock);
+    m_latestMeasurements.clear();
+    m_updatedSignalIndexes.clear();
 }
 
-void SubscriberConnection::PublishMeasurements(const vector<MeasurementPtr>& measurements)
+// Publishes the measurements that were updated since the last throttled publication. Called
+// from the throttled publication timer, publication is serialized with the data publisher's.
+void SubscriberConnection::PublishLatestMeasurements()
 {
-    if (measurements.empty() || !m_isSubscribed)
+    m_latestMeasurementsLock.lock();
+
+    for (const uint16_t signalIndex : m_updatedSignalIndexes)
+    {
+        LatestMeasurement& latestMeasurement = m_latestMeasurements[signalIndex];
+        m_throttledMeasurements.push_back(latestMeasurement.Value);
+        latestMeasurement.Updated = false;
+    }
+
+    m_updatedSignalIndexes.clear();
+    m_latestMeasurementsLock.unlock();
+
+    if (m_throttledMeasurements.empty())
         return;
 
-    if (!m_startTimeSent)
-        m_startTimeSent = SendDataStartTime(measurements[0]->Timestamp);
+    m_parent->m_subscriberConnectionsLock.lock();
 
-    // TODO: Consider queuing measurements for processing
+    if (m_isSubscribed && m_signalIndexCache != nullptr)
+        PublishMeasurementsImpl(m_throttledMeasurements);
 
-    CompactMeasurement serializer(m_signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useCompactMeasurementFormat);
-    vector<uint8_t> packet, buffer;
-    int32_t count = 0;
+    m_parent->m_subscriberConnectionsLock.unlock();
+    m_throttledMeasurements.clear();
+}
 
-    packet.reserve(MaxPacketSize);
-    buffer.reserve(16);
+bool SubscriberConnection::CanSharePublication() const
+{
+    return m_signalIndexCache != nullptr && m_frameConcentrator == nullptr && !m_trackLatestMeasurements && !UsingTSSC() && !CipherKeysDefined();
+}
+
+bool SubscriberConnection::IsPublicationEquivalent(const SubscriberConnection& other) const
+{
+    return
+        m_signalIndexCache == other.m_signalIndexCache &&
+        m_includeTime == other.m_includeTime &&
+        m_useMillisecondResolution == other.m_useMillisecondResolution &&
+        m_isNaNFiltered == other.m_isNaNFiltered &&
+        m_timeIndex == other.m_timeIndex &&
+        m_baseTimeOffsets[0] == other.m_baseTimeOffsets[0] &&
+        m_baseTimeOffsets[1] == other.m_baseTimeOffsets[1];
+}
+
+void SubscriberConnection::SerializeDataPackets(const vector<Measurement>& measurements, vector<BufferPtr>& responses) const
+{
+    SerializeCompactDataPackets(measurements, responses);
+}
+
+void SubscriberConnection::SerializeDataPackets(const vector<MeasurementPtr>& measurements, vector<BufferPtr>& responses) const
+{
+    SerializeCompactDataPackets(measurements, responses);
+}
+
+// Serializes measurements in the compact format directly into response buffers, leaving
+// room at the front of each buffer for the response and data packet headers.
+template<typename T>
+void SubscriberConnection::SerializeCompactDataPackets(const vector<T>& measurements, vector<BufferPtr>& responses) const
+{
+    const uint32_t HeaderSize = DataPublisher::ClientResponseHeaderSize + CompactDataPacketHeaderSize;
+
+    // Serializer only reads base time offsets
+    CompactMeasurement serializer(m_signalIndexCache, const_cast<int64_t*>(m_baseTimeOffsets), m_includeTime, m_useMillisecondResolution, m_timeIndex);
+    BufferPtr response = nullptr;
+    int32_t count = 0;
 
     for (size_t i = 0; i < measurements.size(); i++)
     {
-        const Measurement& measurement = *measurements[i];
+        const Measurement& measurement = GetMeasurement(measurements[i]);
+
+        if (m_isNaNFiltered && IsNaNValue(measurement))
+            continue;
+
         const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
 
         if (runtimeID == UInt16::MaxValue)
             continue;
 
-        const uint32_t length = serializer.SerializeMeasurement(measurement, buffer, runtimeID);
+        if (response == nullptr)
+        {
+            response = NewSharedPtr<vector<uint8_t>>(HeaderSize);
+            response->reserve(HeaderSize + MaxPacketSize + MaxCompactMeasurementSize);
+            count = 0;
+        }
+
+        // Measurements are serialized directly into the response, behind the reserved headers
+        const uint32_t length = serializer.SerializeMeasurement(measurement, *response, runtimeID);
 
-        if (packet.size() + length > MaxPacketSize)
+        if (response->size() - HeaderSize > MaxPacketSize)
         {
-            PublishDataPacket(packet, count);
-            packet.clear();
+            // Move measurement that did not fit into a new response
+            const BufferPtr nextResponse = NewSharedPtr<vector<uint8_t>>(HeaderSize);
+            nextResponse->reserve(HeaderSize + MaxPacketSize + MaxCompactMeasurementSize);
+            nextResponse->insert(nextResponse->end(), response->end() - length, response->end());
+            response->resize(response->size() - length);
+
+            FinishCompactDataPacket(*response, count);
+            responses.push_back(response);
+            response = nextResponse;
             count = 0;
         }
 
-        WriteBytes(packet, buffer);
-        buffer.clear();
         count++;
     }
 
-    if (count > 0)
-        PublishDataPacket(packet, count);
+    if (response != nullptr)
+    {
+        FinishCompactDataPacket(*response, count);
+        responses.push_back(response);
+    }
 }
 
-void SubscriberConnection::PublishDataPacket(const std::vector<uint8_t>& packet, const int32_t count)
+// Writes the response and data packet headers into the space reserved at the front of the response.
+void SubscriberConnection::FinishCompactDataPacket(vector<uint8_t>& response, int32_t count)
 {
-    vector<uint8_t> buffer;
-    buffer.reserve(packet.size() + 5);
+    uint8_t* header = response.data() + DataPublisher::ClientResponseHeaderSize;
+
+    DataPublisher::WriteClientResponseHeader(ServerResponse::DataPacket, ServerCommand::Subscribe, response);
 
     // Serialize data packet flags into response
-    buffer.push_back(DataPacketFlags::Compact);
+    header[0] = DataPacketFlags::Compact;
 
     // Serialize total number of measurement values to follow
-    EndianConverter::WriteBigEndianBytes(buffer, count);
+    EndianConverter::WriteBigEndianBytes(header + 1, count);
+}
 
-    // Serialize measurements to data buffer
-    WriteBytes(buffer, packet);
+// Publishes a concentrated frame as synchronized data packets, the frame timestamp is serialized once
+// per packet instead of with each measurement. Called by the frame concentrator with its lock held.
+void SubscriberConnection::PublishFrame(const ConcentratedFrame& frame)
+{
+    const uint32_t HeaderSize = DataPublisher::ClientResponseHeaderSize + SynchronizedDataPacketHeaderSize;
 
-    // Publish data packet to client
-    m_parent->SendClientResponse(shared_from_this(), ServerResponse::DataPacket, ServerCommand::Subscribe, buffer);
+    CompactMeasurement serializer(m_signalIndexCache, nullptr, false, m_useMillisecondResolution);
+    vector<BufferPtr> responses;
+    BufferPtr response = nullptr;
+    int32_t count = 0;
+
+    for (size_t i = 0; i < frame.Measurements.size(); i++)
+    {
+        if (m_isNaNFiltered && IsNaNValue(frame.Measurements[i]))
+            continue;
+
+        if (response == nullptr)
+        {
+            response = NewSharedPtr<vector<uint8_t>>(HeaderSize);
+            response->reserve(HeaderSize + MaxPacketSize + MaxCompactMeasurementSize);
+            count = 0;
+        }
+
+        const uint32_t length = serializer.SerializeMeasurement(frame.Measurements[i], *response, frame.RuntimeIDs[i]);
+
+        if (response->size() - HeaderSize > MaxPacketSize)
+        {
+            // Move measurement that did not fit into a new response
+            const BufferPtr nextResponse = NewSharedPtr<vector<uint8_t>>(HeaderSize);
+            nextResponse->reserve(HeaderSize + MaxPacketSize + MaxCompactMeasurementSize);
+            nextResponse->insert(nextResponse->end(), response->end() - length, response->end());
+            response->resize(response->size() - length);
+
+            FinishSynchronizedDataPacket(*response, frame.Timestamp, count);
+            responses.push_back(response);
+            response = nextResponse;
+            count = 0;
+        }
+
+        count++;
+    }
+
+    if (response != nullptr)
+    {
+        FinishSynchronizedDataPacket(*response, frame.Timestamp, count);
+        responses.push_back(response);
+    }
+
+    PublishDataPackets(responses, frame.Timestamp);
+}
+
+// Writes the response and synchronized data packet headers into the space reserved at the front of the response.
+void SubscriberConnection::FinishSynchronizedDataPacket(vector<uint8_t>& response, int64_t timestamp, int32_t count)
+{
+    uint8_t* header = response.data() + DataPublisher::ClientResponseHeaderSize;
+
+    DataPublisher::WriteClientResponseHeader(ServerResponse::DataPacket, ServerCommand::Subscribe, response);
+
+    // Serialize data packet flags into response
+    header[0] = DataPacketFlags::Synchronized | DataPacketFlags::Compact;
+
+    // Serialize frame-level timestamp shared by all measurements
+    EndianConverter::WriteBigEndianBytes(header + 1, timestamp);
+
+    // Serialize total number of measurement values to follow
+    EndianConverter::WriteBigEndianBytes(header + 9, count);
+}
+
+void SubscriberConnection::PublishReadyFrames()
+{
+    // Frames are published under the same lock as when they are concentrated by the parent
+    ScopeLock lock(m_parent->m_subscriberConnectionsLock);
+
+    if (m_isSubscribed && m_frameConcentrator != nullptr)
+        m_frameConcentrator->PublishReadyFrames();
+}
+
+void SubscriberConnection::FrameConcentratorNewFrame(FrameConcentrator* source, const ConcentratedFrame& frame)
+{
+    SubscriberConnection* connection = static_cast<SubscriberConnection*>(source->GetUserData());
+
+    if (connection != nullptr)
+        connection->PublishFrame(frame);
+}
+
+void SubscriberConnection::PublishDataPackets(const vector<BufferPtr>& responses, int64_t timestamp)
+{
+    if (!m_isSubscribed)
+        return;
+
+    if (!m_startTimeSent)
+        m_startTimeSent = SendDataStartTime(timestamp);
+
+    if (responses.empty())
+        return;
+
+    const SubscriberConnectionPtr self = shared_from_this();
+
+    // Publish data packets to client
+    for (const BufferPtr& response : responses)
+        m_parent->SendClientResponse(self, ServerResponse::DataPacket, response);
 
     // Track last publication time
     m_lastPublishTime = UtcNow();
 }
 
+void SubscriberConnection::UpdateBaseTimes(int32_t timeIndex, const int64_t* baseTimeOffsets)
+{
+    vector<uint8_t> buffer;
+    buffer.reserve(20);
+
+    EndianConverter::WriteBigEndianBytes(buffer, timeIndex);
+    EndianConverter::WriteBigEndianBytes(buffer, baseTimeOffsets[0]);
+    EndianConverter::WriteBigEndianBytes(buffer, baseTimeOffsets[1]);
+
+    // Offsets are queued ahead of any data packets that use them
+    if (!m_parent->SendClientResponse(shared_from_this(), ServerResponse::UpdateBaseTimes, ServerCommand::Subscribe, buffer))
+        return;
+
+    m_timeIndex = timeIndex;
+    m_baseTimeOffsets[0] = baseTimeOffsets[0];
+    m_baseTimeOffsets[1] = baseTimeOffsets[1];
+}
+
 bool SubscriberConnection::SendDataStartTime(uint64_t timestamp)
 {
     vector<uint8_t> buffer;
@@ -563,14 +1209,178 @@ void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTr
 
 void SubscriberConnection::CommandChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    if (!m_stopped)
-        async_write(m_commandChannelSocket, buffer(&data[offset], length), bind(&SubscriberConnection::WriteHandler, this, _1, _2));
+    // Data must remain valid until send completes
+    CommandChannelSendAsync(NewSharedPtr<vector<uint8_t>>(data + offset, data + offset + length), 0, length);
+}
+
+void SubscriberConnection::CommandChannelSendAsync(const BufferPtr& buffer, uint32_t offset, uint32_t length, bool isDataPacket)
+{
+    if (m_stopped)
+        return;
+
+    const int64_t maxLagTicks = static_cast<int64_t>(m_parent->m_maxSendQueueLagTime * static_cast<float64_t>(Ticks::PerSecond));
+    const uint32_t maxSendQueueSize = m_parent->m_maxSendQueueSize;
+    const QueuedResponse response { buffer, offset, length, isDataPacket, ToTicks(UtcNow()) };
+    string disconnectReason;
+    bool startSending = false;
+
+    {
+        ScopeLock lock(m_sendQueueLock);
+
+        if (m_disconnectRequested)
+            return;
+
+        // Subscriber has fallen behind when the oldest response being written has been waiting too long
+        if (maxLagTicks > 0 && m_sending && !m_activeResponses.empty() && response.QueuedTime - m_activeResponses[0].QueuedTime > maxLagTicks)
+        {
+            disconnectReason = "fell behind by more than " + ToString(m_parent->m_maxSendQueueLagTime) + " seconds";
+        }
+        else if (maxSendQueueSize > 0 && m_sendQueue.size() >= maxSendQueueSize)
+        {
+            if (m_parent->m_sendQueueOverflowPolicy == SendQueueOverflowPolicy::Disconnect)
+                disconnectReason = "exceeded send queue size of " + ToString(maxSendQueueSize) + " responses";
+            else if (DropQueuedDataPackets(response))
+                return;
+        }
+
+        if (disconnectReason.empty())
+        {
+            m_sendQueue.push_back(response);
+
+            if (m_sendQueue.size() > m_peakSendQueueDepth)
+                m_peakSendQueueDepth = static_cast<uint32_t>(m_sendQueue.size());
+
+            if (!m_sending)
+            {
+                m_sending = true;
+                startSending = true;
+            }
+        }
+        else
+        {
+            m_disconnectRequested = true;
+            m_sendQueue.clear();
+        }
+    }
+
+    const SubscriberConnectionPtr self = shared_from_this();
+
+    if (!disconnectReason.empty())
+    {
+        m_parent->DispatchErrorMessage("Disconnecting client \"" + m_connectionID + "\": " + disconnectReason + ".");
+
+        // Publishing thread may hold locks needed to remove the connection, so stop on the I/O thread
+        post(m_commandChannelService, [self] { self->Stop(); });
+        return;
+    }
+
+    if (startSending)
+        post(m_commandChannelService, [self] { self->SendQueuedResponses(); });
+}
+
+// Makes room in a full send queue, called with m_sendQueueLock held. Returns true when the
+// given response is also to be dropped. Only data packets are dropped, other responses
+// are queued regardless.
+bool SubscriberConnection::DropQueuedDataPackets(const QueuedResponse& response)
+{
+    if (!response.IsDataPacket)
+        return false;
+
+    if (UsingTSSC())
+    {
+        // TSSC packets depend on all previous packets, so drop every queued data packet,
+        // including this one, and restart the compression sequence on the next packet
+        const size_t queueSize = m_sendQueue.size();
+
+        m_sendQueue.erase(remove_if(m_sendQueue.begin(), m_sendQueue.end(), [](const QueuedResponse& queuedResponse)
+        {
+            return queuedResponse.IsDataPacket;
+        }), m_sendQueue.end());
+
+        const uint64_t dropped = queueSize - m_sendQueue.size() + 1;
+        m_totalDataPacketsDropped += dropped;
+        m_parent->m_totalDataPacketsDropped += dropped;
+        m_tsscResetRequested = true;
+        return true;
+    }
+
+    const auto oldestDataPacket = find_if(m_sendQueue.begin(), m_sendQueue.end(), [](const QueuedResponse& queuedResponse)
+    {
+        return queuedResponse.IsDataPacket;
+    });
+
+    if (oldestDataPacket != m_sendQueue.end())
+    {
+        m_sendQueue.erase(oldestDataPacket);
+        m_totalDataPacketsDropped++;
+        m_parent->m_totalDataPacketsDropped++;
+    }
+
+    return false;
+}
+
+// Writes the next batch of queued responses to the command channel, only called from the I/O thread.
+void SubscriberConnection::SendQueuedResponses()
+{
+    {
+        ScopeLock lock(m_sendQueueLock);
+
+        m_activeResponses.clear();
+        m_activeBuffers.clear();
+
+        if (m_stopped || m_disconnectRequested || m_sendQueue.empty())
+        {
+            m_sending = false;
+            return;
+        }
+
+        const size_t count = min(m_sendQueue.size(), MaxResponsesPerWrite);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            QueuedResponse& response = m_sendQueue.front();
+            m_activeBuffers.emplace_back(response.Buffer->data() + response.Offset, response.Length);
+            m_activeResponses.push_back(std::move(response));
+            m_sendQueue.pop_front();
+        }
+    }
+
+    // Queued responses are gathered into a single write, active responses keep their buffers alive
+    const SubscriberConnectionPtr self = shared_from_this();
+
+    async_write(m_commandChannelSocket, m_activeBuffers, [self](const ErrorCode& error, size_t bytesTransferred)
+    {
+        self->WriteHandler(error, static_cast<uint32_t>(bytesTransferred));
+    });
 }
 
 void SubscriberConnection::DataChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    // TODO: Implement UDP send
-    CommandChannelSendAsync(data, offset, length);
+    // Datagram must remain valid until send completes
+    DataChannelSendAsync(NewSharedPtr<vector<uint8_t>>(data + offset, data + offset + length), 0, length);
+}
+
+void SubscriberConnection::DataChannelSendAsync(const BufferPtr& buffer, uint32_t offset, uint32_t length, bool pooledBuffer)
+{
+    if (m_stopped)
+        return;
+
+    // Fall back on command channel when client has not requested a data channel
+    if (!m_dataChannelSocket.is_open())
+    {
+        CommandChannelSendAsync(buffer, offset, length);
+        return;
+    }
+
+    const SubscriberConnectionPtr self = shared_from_this();
+
+    m_dataChannelSocket.async_send_to(boost::asio::buffer(buffer->data() + offset, length), m_dataChannelEndPoint, [self, packet = buffer, pooledBuffer](const ErrorCode& error, size_t bytesTransferred) mutable
+    {
+        self->DataChannelWriteHandler(error, static_cast<uint32_t>(bytesTransferred));
+
+        if (pooledBuffer)
+            self->m_dataPacketBufferPool.Release(packet);
+    });
 }
 
 void SubscriberConnection::WriteHandler(const ErrorCode& error, uint32_t bytesTransferred)
@@ -597,16 +1407,81 @@ void SubscriberConnection::WriteHandler(const ErrorCode& error, uint32_t bytesTr
         m_parent->DispatchErrorMessage(messageStream.str());
 
         Stop();
+        return;
     }
+
+    SendQueuedResponses();
+}
+
+uint32_t SubscriberConnection::GetSendQueueDepth()
+{
+    ScopeLock lock(m_sendQueueLock);
+    return static_cast<uint32_t>(m_sendQueue.size());
+}
+
+uint32_t SubscriberConnection::GetPeakSendQueueDepth() const
+{
+    return m_peakSendQueueDepth;
+}
+
+uint64_t SubscriberConnection::GetTotalDataPacketsDropped() const
+{
+    return m_totalDataPacketsDropped;
 }
 
+void SubscriberConnection::DataChannelWriteHandler(const ErrorCode& error, uint32_t bytesTransferred)
+{
+    // Data channel is lossy by design, so send failures are reported but do not stop the connection
+    if (m_stopped || !error || error == error::operation_aborted)
+        return;
+
+    stringstream messageStream;
+
+    messageStream << "Error writing data to client \"";
+    messageStream << m_connectionID;
+    messageStream << "\" data channel: ";
+    messageStream << SystemError(error).what();
+
+    m_parent->DispatchErrorMessage(messageStream.str());
+}
+
+// Timer callbacks run on the shared timer scheduler thread. They hold a reference to the connection
+// while running, so it cannot be destroyed on another thread mid-callback.
 void SubscriberConnection::PingTimerElapsed(Timer* timer, void* userData)
 {
-    SubscriberConnection* connection = static_cast<SubscriberConnection*>(userData);
+    SubscriberConnection* source = static_cast<SubscriberConnection*>(userData);
+
+    if (source == nullptr)
+        return;
+
+    const SubscriberConnectionPtr connection = source->shared_from_this();
+
+    if (!connection->m_stopped)
+        connection->m_parent->SendClientResponse(connection, ServerResponse::NoOP, ServerCommand::Subscribe);
+}
+
+void SubscriberConnection::ThrottledPublicationTimerElapsed(Timer* timer, void* userData)
+{
+    SubscriberConnection* source = static_cast<SubscriberConnection*>(userData);
 
-    if (connection == nullptr)
+    if (source == nullptr)
         return;
 
+    const SubscriberConnectionPtr connection = source->shared_from_this();
+
+    if (!connection->m_stopped)
+        connection->PublishLatestMeasurements();
+}
+
+void SubscriberConnection::FramePublicationTimerElapsed(Timer* timer, void* userData)
+{
+    SubscriberConnection* source = static_cast<SubscriberConnection*>(userData);
+
+    if (source == nullptr)
+        return;
+
+    const SubscriberConnectionPtr connection = source->shared_from_this();
+
     if (!connection->m_stopped)
-        connection->m_parent->SendClientResponse(connection->shared_from_this(), ServerResponse::NoOP, ServerCommand::Subscribe);
+        connection->PublishReadyFrames();
 }
\ No newline at end of file
@@ -25,9 +25,15 @@
 #define __SUBSCRIBER_CONNECTION_H
 
 #include "../Common/CommonTypes.h"
+#include "../Common/AesCipher.h"
+#include "../Common/BufferPool.h"
 #include "../Common/Timer.h"
 #include "SignalIndexCache.h"
+#include "FrameConcentrator.h"
 #include "TransportTypes.h"
+#include "TSSCMeasurementEncoder.h"
+#include <atomic>
+#include <deque>
 
 namespace GSF {
 namespace TimeSeries {
@@ -40,9 +46,28 @@ namespace Transport
     class SubscriberConnection : public GSF::EnableSharedThisPtr<SubscriberConnection> // NOLINT
     {
     private:
+        // Response waiting to be written to the command channel.
+        struct QueuedResponse
+        {
+            BufferPtr Buffer;
+            uint32_t Offset;
+            uint32_t Length;
+            bool IsDataPacket;
+            int64_t QueuedTime;
+        };
+
+        // Latest measurement received for a signal of a throttled subscription.
+        struct LatestMeasurement
+        {
+            Measurement Value;
+            bool Updated;
+        };
+
         const DataPublisherPtr m_parent;
         GSF::IOContext& m_commandChannelService;
         GSF::Timer m_pingTimer;
+        GSF::Timer m_throttledPublicationTimer;
+        GSF::Timer m_framePublicationTimer;
         GSF::Guid m_subscriberID;
         std::string m_connectionID;
         std::string m_subscriptionInfo;
@@ -53,6 +78,9 @@ namespace Transport
         bool m_includeTime;
         bool m_useMillisecondResolution;
         bool m_isNaNFiltered;
+        bool m_trackLatestMeasurements;
+        float64_t m_lagTime;
+        int32_t m_processingInterval;
         bool m_isSubscribed;
         bool m_startTimeSent;
         bool m_stopped;
@@ -63,27 +91,79 @@ namespace Transport
         GSF::IPAddress m_ipAddress;
         std::string m_hostName;
 
+        // Command channel send queue, only one write is outstanding on the socket at a time
+        std::deque<QueuedResponse> m_sendQueue;
+        std::vector<QueuedResponse> m_activeResponses;
+        std::vector<boost::asio::const_buffer> m_activeBuffers;
+        GSF::Mutex m_sendQueueLock;
+        bool m_sending;
+        bool m_disconnectRequested;
+        uint32_t m_peakSendQueueDepth;
+        uint64_t m_totalDataPacketsDropped;
+
         // Data channel
-        int16_t m_udpPort;
-        GSF::UdpSocket m_dataChannelSocket;        
+        uint16_t m_udpPort;
+        GSF::UdpSocket m_dataChannelSocket;
+        GSF::UdpEndPoint m_dataChannelEndPoint;
         std::vector<uint8_t> m_keys[2];
         std::vector<uint8_t> m_ivs[2];
+        GSF::AesCipher m_ciphers[2];
+        int32_t m_cipherIndex;
+        std::atomic<bool> m_cipherKeysDefined;
+        GSF::Mutex m_cipherLock;
+
+        // Encrypted data packets are written into buffers from this pool, which are returned
+        // once the datagram has been sent, so steady state encryption does not allocate
+        GSF::BufferPool m_dataPacketBufferPool;
 
         // Measurement parsing
         SignalIndexCachePtr m_signalIndexCache;
+        FrameConcentratorPtr m_frameConcentrator;
         int32_t m_timeIndex;
         int64_t m_baseTimeOffsets[2];
         DateTime m_lastPublishTime;
-        //TSSCMeasurementParser m_tsscMeasurementParser;
-        //bool m_tsscResetRequested;
-        //uint16_t m_tsscSequenceNumber;
+        TSSCMeasurementEncoder m_tsscEncoder;
+        BufferPtr m_tsscResponse;
+        GSF::Mutex m_tsscLock;
+        bool m_tsscResetRequested;
+        uint16_t m_tsscSequenceNumber;
+
+        // Throttled publication, latest measurements are held in slots indexed by runtime ID
+        std::vector<LatestMeasurement> m_latestMeasurements;
+        std::vector<uint16_t> m_updatedSignalIndexes;
+        std::vector<Measurement> m_throttledMeasurements;
+        GSF::Mutex m_latestMeasurementsLock;
 
-        void PublishDataPacket(const std::vector<uint8_t>& packet, int32_t count);
+        template<typename T>
+        void PublishMeasurementsImpl(const std::vector<T>& measurements);
+        template<typename T>
+        void UpdateLatestMeasurements(const std::vector<T>& measurements);
+        void ClearLatestMeasurements();
+        void GenerateCipherKeys(int32_t cipherIndex);
+        void PublishLatestMeasurements();
+        void PublishReadyFrames();
+        int32_t GetThrottledPublicationInterval() const;
+        bool UsingTSSC() const;
+        void BeginTSSCPublication();
+        void BeginTSSCDataPacket();
+        void PublishTSSCMeasurement(const Measurement& measurement, int32_t& count);
+        void PublishTSSCDataPacket(int32_t count);
+        template<typename T>
+        void SerializeCompactDataPackets(const std::vector<T>& measurements, std::vector<BufferPtr>& responses) const;
+        static void FinishCompactDataPacket(std::vector<uint8_t>& response, int32_t count);
+        void PublishFrame(const ConcentratedFrame& frame);
+        static void FinishSynchronizedDataPacket(std::vector<uint8_t>& response, int64_t timestamp, int32_t count);
+        static void FrameConcentratorNewFrame(FrameConcentrator* source, const ConcentratedFrame& frame);
         bool SendDataStartTime(uint64_t timestamp);
+        bool DropQueuedDataPackets(const QueuedResponse& response);
+        void SendQueuedResponses();
         void ReadCommandChannel();
         void ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred);
         void ParseCommand(const ErrorCode& error, uint32_t bytesTransferred);
+        void DataChannelWriteHandler(const ErrorCode& error, uint32_t bytesTransferred);
         static void PingTimerElapsed(Timer* timer, void* userData);
+        static void ThrottledPublicationTimerElapsed(Timer* timer, void* userData);
+        static void FramePublicationTimerElapsed(Timer* timer, void* userData);
     public:
         SubscriberConnection(DataPublisherPtr parent, GSF::IOContext& commandChannelService, GSF::IOContext& dataChannelService);
         ~SubscriberConnection();
@@ -120,6 +200,21 @@ namespace Transport
         bool GetIsNaNFiltered() const;
         void SetIsNaNFiltered(bool value);
 
+        // Gets or sets flag that determines whether the subscription is throttled, i.e., only the
+        // latest measurement of each signal is tracked and published on the processing interval.
+        bool GetTrackLatestMeasurements() const;
+        void SetTrackLatestMeasurements(bool value);
+
+        // Gets or sets the lag time, in seconds, used as the publication interval of a
+        // throttled subscription when no processing interval is defined.
+        float64_t GetLagTime() const;
+        void SetLagTime(float64_t value);
+
+        // Gets or sets the processing interval, in milliseconds, at which a throttled subscription
+        // publishes its latest measurements. Zero or less defaults to the lag time.
+        int32_t GetProcessingInterval() const;
+        void SetProcessingInterval(int32_t value);
+
         bool GetIsSubscribed() const;
         void SetIsSubscribed(bool value);
 
@@ -129,19 +224,84 @@ namespace Transport
         const SignalIndexCachePtr& GetSignalIndexCache() const;
         void SetSignalIndexCache(SignalIndexCachePtr signalIndexCache);
 
+        // Gets or sets the frame concentrator of a synchronized subscription, measurements are
+        // published as frames of time-aligned data when defined. Set to nullptr to unsynchronize.
+        const FrameConcentratorPtr& GetFrameConcentrator() const;
+        void SetFrameConcentrator(FrameConcentratorPtr frameConcentrator);
+
+        // Opens the UDP data channel to the given port on the subscriber, a port of zero closes it.
+        // On failure, error is set and the data channel is left closed.
+        void OpenDataChannel(uint16_t port, ErrorCode& error);
+        bool DataChannelDefined() const;
+        uint16_t GetDataChannelPort() const;
+
         bool CipherKeysDefined() const;
         std::vector<uint8_t> Keys(int32_t cipherIndex);
         std::vector<uint8_t> IVs(int32_t cipherIndex);
 
+        // Gets the index of the cipher key set used to encrypt data packets.
+        int32_t GetCipherIndex();
+
+        // Rotates the cipher keys used to encrypt data packets sent on the data channel and sends
+        // the key sets to the subscriber. The first call defines the keys and enables encryption.
+        void RotateCipherKeys();
+
+        // Encrypts the payload of a data packet response, following the data packet flags, with the
+        // active cipher key set into a buffer from the connection's data packet pool. Published responses
+        // can be shared by several connections, so they are never modified. Response headers must be
+        // rewritten for the new length, and the packet sent with DataChannelSendAsync as a pooled buffer.
+        BufferPtr EncryptDataPacket(const std::vector<uint8_t>& response);
+
         void Start();
         void Stop();
 
         void PublishMeasurements(const std::vector<Measurement>& measurements);
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
 
+        // Determines whether data packets serialized for this connection can be shared with
+        // other connections, i.e., the connection does not use stateful compression or encryption.
+        bool CanSharePublication() const;
+
+        // Determines whether measurements serialize to identical data packets for both connections.
+        bool IsPublicationEquivalent(const SubscriberConnection& other) const;
+
+        // Serializes measurements into complete data packet responses that can be sent to
+        // this connection, or any equivalent connection, with PublishDataPackets.
+        void SerializeDataPackets(const std::vector<Measurement>& measurements, std::vector<BufferPtr>& responses) const;
+        void SerializeDataPackets(const std::vector<MeasurementPtr>& measurements, std::vector<BufferPtr>& responses) const;
+
+        // Sends data packet responses serialized with SerializeDataPackets to the subscriber.
+        void PublishDataPackets(const std::vector<BufferPtr>& responses, int64_t timestamp);
+
+        // Sends new base time offsets to the subscriber, after which compact measurement
+        // timestamps for this connection are serialized relative to them.
+        void UpdateBaseTimes(int32_t timeIndex, const int64_t* baseTimeOffsets);
+
         void CommandChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length);
         void DataChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Sends part of a buffer that is shared rather than copied, the
+        // buffer must not be modified until the send has completed.
+        //
+        // Command channel sends are queued, and written in order by the publisher's I/O thread. When
+        // the queue reaches the publisher's maximum send queue size, or the subscriber falls behind
+        // by more than the maximum send queue lag time, the send queue overflow policy is applied.
+        // Data packets may be dropped, other responses are always queued.
+        void CommandChannelSendAsync(const BufferPtr& buffer, uint32_t offset, uint32_t length, bool isDataPacket = false);
+
+        // Pooled buffers, i.e., those from EncryptDataPacket, are returned to the data packet pool once
+        // the datagram has been sent, so the caller must not use the buffer after this call.
+        void DataChannelSendAsync(const BufferPtr& buffer, uint32_t offset, uint32_t length, bool pooledBuffer = false);
         void WriteHandler(const ErrorCode& error, uint32_t bytesTransferred);
+
+        // Gets the number of responses waiting to be written to the command channel.
+        uint32_t GetSendQueueDepth();
+
+        // Gets the largest number of responses that have been waiting to be written to the command channel.
+        uint32_t GetPeakSendQueueDepth() const;
+
+        // Gets the total number of data packets dropped from the send queue.
+        uint64_t GetTotalDataPacketsDropped() const;
     };
 
     typedef GSF::SharedPtr<SubscriberConnection> SubscriberConnectionPtr;
@@ -40,6 +40,7 @@ SubscriberInstance::SubscriberInstance() :
     m_udpPort(0U),
     m_autoReconnect(true),
     m_autoParseMetadata(true),
+    m_assembleFrames(false),
     m_maxRetries(-1),
     m_retryInterval(2000),
     m_filterExpression(SubscribeAllNoStatsExpression),
@@ -49,6 +50,15 @@ SubscriberInstance::SubscriberInstance() :
 {
     // Reference this SubscriberInstance in DataSubsciber user data
     m_subscriber.SetUserData(this);
+
+    // Reference this SubscriberInstance in FrameAssembler user data
+    m_frameAssembler.SetUserData(this);
+    m_frameAssembler.RegisterNewFramesCallback(&HandleNewFrames);
+
+    // Setup frame publication timer, interval is set by the frame assembler frame rate
+    m_framePublicationTimer.SetAutoReset(true);
+    m_framePublicationTimer.SetCallback(&FramePublicationTimerElapsed);
+    m_framePublicationTimer.SetUserData(this);
 }
 
 SubscriberInstance::~SubscriberInstance() = default;
@@ -87,6 +97,21 @@ void SubscriberInstance::SetAutoParseMetadata(bool autoParseMetadata)
     m_autoParseMetadata = autoParseMetadata;
 }
 
+bool SubscriberInstance::GetAssembleFrames() const
+{
+    return m_assembleFrames;
+}
+
+void SubscriberInstance::SetAssembleFrames(bool assembleFrames)
+{
+    m_assembleFrames = assembleFrames;
+}
+
+FrameAssembler& SubscriberInstance::GetFrameAssembler()
+{
+    return m_frameAssembler;
+}
+
 int16_t SubscriberInstance::GetMaxRetries() const
 {
     return m_maxRetries;
@@ -159,6 +184,7 @@ void SubscriberInstance::Connect()
     m_subscriber.RegisterDataStartTimeCallback(&HandleDataStartTime);
     m_subscriber.RegisterMetadataCallback(&HandleMetadata);
     m_subscriber.RegisterNewMeasurementsCallback(&HandleNewMeasurements);
+    m_subscriber.RegisterNewMeasurementValuesCallback(m_assembleFrames ? &HandleNewMeasurementValues : nullptr);
     m_subscriber.RegisterConfigurationChangedCallback(&HandleConfigurationChanged);
     m_subscriber.RegisterConnectionTerminatedCallback(&HandleConnectionTerminated);
 
@@ -175,6 +201,25 @@ void SubscriberInstance::Connect()
         m_subscriptionInfo.DataChannelLocalPort = m_udpPort;
     }
 
+    if (m_assembleFrames)
+    {
+        m_frameAssembler.SetLagTime(m_subscriptionInfo.LagTime);
+        m_frameAssembler.SetLeadTime(m_subscriptionInfo.LeadTime);
+        m_frameAssembler.SetUseLocalClockAsRealTime(m_subscriptionInfo.UseLocalClockAsRealTime);
+        m_frameAssembler.Reset();
+    }
+
+    // Frames timed by the local clock are published at the frame rate whether or not data arrives
+    if (m_assembleFrames && m_subscriptionInfo.UseLocalClockAsRealTime)
+    {
+        m_framePublicationTimer.SetInterval(m_frameAssembler.GetFrameInterval());
+        m_framePublicationTimer.Start();
+    }
+    else
+    {
+        m_framePublicationTimer.Stop();
+    }
+
     // Connect and subscribe to publisher
     if (connector.Connect(m_subscriber, m_subscriptionInfo))
     {
@@ -196,6 +241,7 @@ void SubscriberInstance::Connect()
 
 void SubscriberInstance::Disconnect()
 {
+    m_framePublicationTimer.Stop();
     m_subscriber.Disconnect();
 }
 
@@ -752,6 +798,23 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
 
     m_configurationUpdateLock.unlock();
 
+    m_frameAssembler.DefineConfigurationFrames(configurationFrames);
+
+    // Frames are published at the highest reporting rate of the devices
+    uint16_t framesPerSecond = 0;
+
+    for (auto const& item : devices)
+    {
+        if (item.second->FramesPerSecond > framesPerSecond)
+            framesPerSecond = item.second->FramesPerSecond;
+    }
+
+    if (framesPerSecond > 0)
+    {
+        m_frameAssembler.SetFramesPerSecond(framesPerSecond);
+        m_framePublicationTimer.SetInterval(m_frameAssembler.GetFrameInterval());
+    }
+
     stringstream message;
     message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from GEP meta data...";
     StatusMessage(message.str());
@@ -1001,6 +1064,10 @@ void SubscriberInstance::ReceivedNewMeasurements(const vector<MeasurementPtr>& m
 {
 }
 
+void SubscriberInstance::ReceivedNewFrames(int64_t timestamp, const vector<DeviceFrame*>& frames)
+{
+}
+
 void SubscriberInstance::ConfigurationChanged()
 {
 }
@@ -1081,6 +1148,18 @@ void SubscriberInstance::HandleNewMeasurements(DataSubscriber* source, const vec
     instance->ReceivedNewMeasurements(measurements);
 }
 
+void SubscriberInstance::HandleNewMeasurementValues(DataSubscriber* source, const MeasurementValue* measurements, uint32_t count)
+{
+    SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
+    instance->m_frameAssembler.AddMeasurements(measurements, count);
+}
+
+void SubscriberInstance::HandleNewFrames(FrameAssembler* source, int64_t timestamp, const vector<DeviceFrame*>& frames)
+{
+    SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
+    instance->ReceivedNewFrames(timestamp, frames);
+}
+
 void SubscriberInstance::HandleConfigurationChanged(DataSubscriber* source)
 {
     SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
@@ -1095,6 +1174,11 @@ void SubscriberInstance::HandleConfigurationChanged(DataSubscriber* source)
 void SubscriberInstance::HandleProcessingComplete(DataSubscriber* source, const string& message)
 {
     SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
+
+    // Deliver any frames still waiting on the lag time
+    if (instance->m_assembleFrames)
+        instance->m_frameAssembler.Flush();
+
     instance->StatusMessage(message);
     instance->HistoricalReadComplete();
 }
@@ -1103,4 +1187,12 @@ void SubscriberInstance::HandleConnectionTerminated(DataSubscriber* source)
 {
     SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
     instance->ConnectionTerminated();
+}
+
+void SubscriberInstance::FramePublicationTimerElapsed(Timer* timer, void* userData)
+{
+    SubscriberInstance* instance = static_cast<SubscriberInstance*>(userData);
+
+    if (instance != nullptr)
+        instance->m_frameAssembler.PublishReadyFrames();
 }
\ No newline at end of file
@@ -25,6 +25,8 @@
 #define __SUBSCRIBERINSTANCE_H
 
 #include "DataSubscriber.h"
+#include "FrameAssembler.h"
+#include "../Common/Timer.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -39,6 +41,7 @@ namespace Transport
         uint16_t m_udpPort;
         bool m_autoReconnect;
         bool m_autoParseMetadata;
+        bool m_assembleFrames;
         int16_t m_maxRetries;
         int16_t m_retryInterval;
         std::string m_filterExpression;
@@ -52,6 +55,8 @@ namespace Transport
         GSF::StringMap<DeviceMetadataPtr> m_devices;
         std::unordered_map<Guid, MeasurementMetadataPtr> m_measurements;
         GSF::StringMap<ConfigurationFramePtr> m_configurationFrames;
+        FrameAssembler m_frameAssembler;
+        GSF::Timer m_framePublicationTimer;
 
         Mutex m_configurationUpdateLock;
         void SendMetadataRefreshCommand();
@@ -68,9 +73,12 @@ namespace Transport
         static void HandleDataStartTime(DataSubscriber* source, int64_t startTime);
         static void HandleMetadata(DataSubscriber* source, const std::vector<uint8_t>& payload);
         static void HandleNewMeasurements(DataSubscriber* source, const std::vector<MeasurementPtr>& measurements);
+        static void HandleNewMeasurementValues(DataSubscriber* source, const MeasurementValue* measurements, uint32_t count);
+        static void HandleNewFrames(FrameAssembler* source, int64_t timestamp, const std::vector<DeviceFrame*>& frames);
         static void HandleProcessingComplete(DataSubscriber* source, const std::string& message);
         static void HandleConfigurationChanged(DataSubscriber* source);
         static void HandleConnectionTerminated(DataSubscriber* source);
+        static void FramePublicationTimerElapsed(Timer* timer, void* userData);
 
     protected:
         virtual void SetupSubscriberConnector(SubscriberConnector& connector);
@@ -82,6 +90,7 @@ namespace Transport
         virtual void ReceivedMetadata(const std::vector<uint8_t>& payload);
         virtual void ParsedMetadata();
         virtual void ReceivedNewMeasurements(const std::vector<MeasurementPtr>& measurements);
+        virtual void ReceivedNewFrames(int64_t timestamp, const std::vector<DeviceFrame*>& frames);
         virtual void ConfigurationChanged();
         virtual void HistoricalReadComplete();
         virtual void ConnectionEstablished();
@@ -122,6 +131,16 @@ namespace Transport
         bool GetAutoParseMetadata() const;
         void SetAutoParseMetadata(bool autoParseMetadata);
 
+        // Gets or sets flag that determines if received measurements should be
+        // assembled into time-aligned frames, per the configuration frames parsed
+        // from metadata and the subscription lag and lead times, and delivered to
+        // ReceivedNewFrames. Requires auto-parsed metadata. Takes effect on connect.
+        bool GetAssembleFrames() const;
+        void SetAssembleFrames(bool assembleFrames);
+
+        // Gets the frame assembler used when frame assembly is enabled.
+        FrameAssembler& GetFrameAssembler();
+
         // Gets or sets maximum connection retries
         int16_t GetMaxRetries() const;
         void SetMaxRetries(int16_t maxRetries);
@@ -0,0 +1,477 @@
+//******************************************************************************************************
+//  TSSCMeasurementEncoder.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "TSSCMeasurementEncoder.h"
+#include "Constants.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+static const uint32_t Bits28 = 0xFFFFFFFU;
+static const uint32_t Bits24 = 0xFFFFFFU;
+static const uint32_t Bits20 = 0xFFFFFU;
+static const uint32_t Bits16 = 0xFFFFU;
+static const uint32_t Bits12 = 0xFFFU;
+static const uint32_t Bits8 = 0xFFU;
+static const uint32_t Bits4 = 0xFU;
+
+// Largest single measurement is well under this size, so once fewer bytes
+// than this remain in the buffer no further measurements are accepted
+static const uint32_t MinimumBufferSpace = 100U;
+
+void Encode7BitUInt32(uint8_t* stream, uint32_t& position, uint32_t value);
+void Encode7BitUInt64(uint8_t* stream, uint32_t& position, uint64_t value);
+
+TSSCMeasurementEncoder::TSSCMeasurementEncoder() :
+    m_data(nullptr),
+    m_position(0),
+    m_lastPosition(0),
+    m_prevTimestamp1(0L),
+    m_prevTimestamp2(0L),
+    m_prevTimeDelta1(Int64::MaxValue),
+    m_prevTimeDelta2(Int64::MaxValue),
+    m_prevTimeDelta3(Int64::MaxValue),
+    m_prevTimeDelta4(Int64::MaxValue),
+    m_bitStreamBufferIndex(-1),
+    m_bitStreamCount(0),
+    m_bitStreamCache(0)
+{
+    m_lastPoint = NewSharedPtr<TSSCPointMetadata>(this);
+}
+
+void TSSCMeasurementEncoder::Reset()
+{
+    m_data = nullptr;
+    m_points.clear();
+    m_lastPoint = NewSharedPtr<TSSCPointMetadata>(this);
+    m_position = 0;
+    m_lastPosition = 0;
+    ClearBitStream();
+    m_prevTimeDelta1 = Int64::MaxValue;
+    m_prevTimeDelta2 = Int64::MaxValue;
+    m_prevTimeDelta3 = Int64::MaxValue;
+    m_prevTimeDelta4 = Int64::MaxValue;
+    m_prevTimestamp1 = 0L;
+    m_prevTimestamp2 = 0L;
+}
+
+void TSSCMeasurementEncoder::SetBuffer(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    ClearBitStream();
+    m_data = data;
+    m_position = offset;
+    m_lastPosition = offset + length;
+}
+
+uint32_t TSSCMeasurementEncoder::FinishBlock()
+{
+    BitStreamFlush();
+    return m_position;
+}
+
+bool TSSCMeasurementEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t quality, float32_t value)
+{
+    if (m_lastPosition - m_position < MinimumBufferSpace)
+        return false;
+
+    TSSCPointMetadataPtr point = id >= m_points.size() ? nullptr : m_points[id];
+
+    if (point == nullptr)
+    {
+        point = NewSharedPtr<TSSCPointMetadata>(this);
+
+        if (id >= m_points.size())
+            m_points.resize(id + 1, nullptr);
+
+        m_points[id] = point;
+
+        point->PrevNextPointId1 = static_cast<uint16_t>(id + 1);
+    }
+
+    //Note: the decoder will not know the incoming pointID, so the
+    //      code words are always written using the metadata of the
+    //      most recent measurement, matching TSSCMeasurementParser.
+
+    if (m_lastPoint->PrevNextPointId1 != id)
+        WritePointIDChange(id);
+
+    if (m_prevTimestamp1 != timestamp)
+        WriteTimestampChange(timestamp);
+
+    if (point->PrevQuality1 != quality)
+        WriteQualityChange(quality, point);
+
+    //Since value will almost always change,
+    //This is not put inside a function call.
+    const uint32_t valueRaw = *reinterpret_cast<uint32_t*>(&value);
+
+    if (point->PrevValue1 == valueRaw)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::Value1);
+    }
+    else if (point->PrevValue2 == valueRaw)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::Value2);
+        point->PrevValue2 = point->PrevValue1;
+        point->PrevValue1 = valueRaw;
+    }
+    else if (point->PrevValue3 == valueRaw)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::Value3);
+        point->PrevValue3 = point->PrevValue2;
+        point->PrevValue2 = point->PrevValue1;
+        point->PrevValue1 = valueRaw;
+    }
+    else if (valueRaw == 0)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::ValueZero);
+        point->PrevValue3 = point->PrevValue2;
+        point->PrevValue2 = point->PrevValue1;
+        point->PrevValue1 = 0;
+    }
+    else
+    {
+        const uint32_t bitsChanged = valueRaw ^ point->PrevValue1;
+
+        if (bitsChanged <= Bits4)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR4);
+            WriteBits(static_cast<int32_t>(bitsChanged & 15), 4);
+        }
+        else if (bitsChanged <= Bits8)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR8);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged);
+            m_position++;
+        }
+        else if (bitsChanged <= Bits12)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR12);
+            WriteBits(static_cast<int32_t>(bitsChanged & 15), 4);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
+            m_position++;
+        }
+        else if (bitsChanged <= Bits16)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR16);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged);
+            m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
+            m_position += 2;
+        }
+        else if (bitsChanged <= Bits20)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR20);
+            WriteBits(static_cast<int32_t>(bitsChanged & 15), 4);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
+            m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 12);
+            m_position += 2;
+        }
+        else if (bitsChanged <= Bits24)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR24);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged);
+            m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
+            m_data[m_position + 2] = static_cast<uint8_t>(bitsChanged >> 16);
+            m_position += 3;
+        }
+        else if (bitsChanged <= Bits28)
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR28);
+            WriteBits(static_cast<int32_t>(bitsChanged & 15), 4);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
+            m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 12);
+            m_data[m_position + 2] = static_cast<uint8_t>(bitsChanged >> 20);
+            m_position += 3;
+        }
+        else
+        {
+            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR32);
+            m_data[m_position] = static_cast<uint8_t>(bitsChanged);
+            m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
+            m_data[m_position + 2] = static_cast<uint8_t>(bitsChanged >> 16);
+            m_data[m_position + 3] = static_cast<uint8_t>(bitsChanged >> 24);
+            m_position += 4;
+        }
+
+        point->PrevValue3 = point->PrevValue2;
+        point->PrevValue2 = point->PrevValue1;
+        point->PrevValue1 = valueRaw;
+    }
+
+    m_lastPoint = point;
+
+    return true;
+}
+
+void TSSCMeasurementEncoder::WritePointIDChange(uint16_t id)
+{
+    const uint32_t bitsChanged = static_cast<uint32_t>(id ^ m_lastPoint->PrevNextPointId1);
+
+    if (bitsChanged <= Bits4)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR4);
+        WriteBits(static_cast<int32_t>(bitsChanged & 15), 4);
+    }
+    else if (bitsChanged <= Bits8)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR8);
+        m_data[m_position] = static_cast<uint8_t>(bitsChanged);
+        m_position++;
+    }
+    else if (bitsChanged <= Bits12)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR12);
+        WriteBits(static_cast<int32_t>(bitsChanged & 15), 4);
+        m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
+        m_position++;
+    }
+    else
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR16);
+        m_data[m_position] = static_cast<uint8_t>(bitsChanged);
+        m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
+        m_position += 2;
+    }
+
+    m_lastPoint->PrevNextPointId1 = id;
+}
+
+void TSSCMeasurementEncoder::WriteTimestampChange(int64_t timestamp)
+{
+    if (m_prevTimestamp1 + m_prevTimeDelta1 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta1Forward);
+    }
+    else if (m_prevTimestamp1 + m_prevTimeDelta2 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta2Forward);
+    }
+    else if (m_prevTimestamp1 + m_prevTimeDelta3 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta3Forward);
+    }
+    else if (m_prevTimestamp1 + m_prevTimeDelta4 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta4Forward);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta1 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta1Reverse);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta2 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta2Reverse);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta3 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta3Reverse);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta4 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta4Reverse);
+    }
+    else if (m_prevTimestamp2 == timestamp)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::Timestamp2);
+    }
+    else
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::TimeXOR7Bit);
+        Encode7BitUInt64(m_data, m_position, static_cast<uint64_t>(timestamp ^ m_prevTimestamp1));
+    }
+
+    // Save the smallest delta time
+    const int64_t minDelta = abs(m_prevTimestamp1 - timestamp);
+
+    if (minDelta < m_prevTimeDelta4 && minDelta != m_prevTimeDelta1 && minDelta != m_prevTimeDelta2 && minDelta != m_prevTimeDelta3)
+    {
+        if (minDelta < m_prevTimeDelta1)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = m_prevTimeDelta2;
+            m_prevTimeDelta2 = m_prevTimeDelta1;
+            m_prevTimeDelta1 = minDelta;
+        }
+        else if (minDelta < m_prevTimeDelta2)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = m_prevTimeDelta2;
+            m_prevTimeDelta2 = minDelta;
+        }
+        else if (minDelta < m_prevTimeDelta3)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = minDelta;
+        }
+        else
+        {
+            m_prevTimeDelta4 = minDelta;
+        }
+    }
+
+    m_prevTimestamp2 = m_prevTimestamp1;
+    m_prevTimestamp1 = timestamp;
+}
+
+void TSSCMeasurementEncoder::WriteQualityChange(uint32_t quality, const TSSCPointMetadataPtr& point)
+{
+    if (point->PrevQuality2 == quality)
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::Quality2);
+    }
+    else
+    {
+        m_lastPoint->WriteCode(TSSCCodeWords::Quality7Bit32);
+        Encode7BitUInt32(m_data, m_position, quality);
+    }
+
+    point->PrevQuality2 = point->PrevQuality1;
+    point->PrevQuality1 = quality;
+}
+
+void TSSCMeasurementEncoder::ClearBitStream()
+{
+    m_bitStreamBufferIndex = -1;
+    m_bitStreamCount = 0;
+    m_bitStreamCache = 0;
+}
+
+void TSSCMeasurementEncoder::WriteBits(int32_t code, int32_t length)
+{
+    // Reserve a byte in the stream for the bits, the decoder
+    // will read it at this position when it needs more bits
+    if (m_bitStreamBufferIndex < 0)
+        m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
+
+    m_bitStreamCache = (m_bitStreamCache << length) | static_cast<uint32_t>(code);
+    m_bitStreamCount += length;
+
+    if (m_bitStreamCount > 7)
+        BitStreamEnd();
+}
+
+void TSSCMeasurementEncoder::BitStreamFlush()
+{
+    if (m_bitStreamCount > 0)
+    {
+        if (m_bitStreamBufferIndex < 0)
+            m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
+
+        // Remaining bits are padded, so mark the end of the stream
+        // so the decoder does not interpret padding as a code word
+        m_lastPoint->WriteCode(TSSCCodeWords::EndOfStream);
+
+        if (m_bitStreamCount > 7)
+            BitStreamEnd();
+
+        if (m_bitStreamCount > 0)
+        {
+            // Make up 8 bits by padding
+            m_bitStreamCache <<= 8 - m_bitStreamCount;
+            m_data[m_bitStreamBufferIndex] = static_cast<uint8_t>(m_bitStreamCache);
+            ClearBitStream();
+        }
+    }
+}
+
+void TSSCMeasurementEncoder::BitStreamEnd()
+{
+    while (m_bitStreamCount > 7)
+    {
+        m_data[m_bitStreamBufferIndex] = static_cast<uint8_t>(m_bitStreamCache >> (m_bitStreamCount - 8));
+        m_bitStreamCount -= 8;
+
+        if (m_bitStreamCount > 0)
+            m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
+        else
+            m_bitStreamBufferIndex = -1;
+    }
+}
+
+void Encode7BitUInt32(uint8_t* stream, uint32_t& position, uint32_t value)
+{
+    stream += position;
+
+    if (value < 128U)
+    {
+        stream[0] = static_cast<uint8_t>(value);
+        position++;
+        return;
+    }
+
+    stream[0] = static_cast<uint8_t>(value | 128U);
+
+    if (value < 16384U)
+    {
+        stream[1] = static_cast<uint8_t>(value >> 7);
+        position += 2;
+        return;
+    }
+
+    stream[1] = static_cast<uint8_t>((value >> 7) | 128U);
+
+    if (value < 2097152U)
+    {
+        stream[2] = static_cast<uint8_t>(value >> 14);
+        position += 3;
+        return;
+    }
+
+    stream[2] = static_cast<uint8_t>((value >> 14) | 128U);
+
+    if (value < 268435456U)
+    {
+        stream[3] = static_cast<uint8_t>(value >> 21);
+        position += 4;
+        return;
+    }
+
+    stream[3] = static_cast<uint8_t>((value >> 21) | 128U);
+    stream[4] = static_cast<uint8_t>(value >> 28);
+    position += 5;
+}
+
+void Encode7BitUInt64(uint8_t* stream, uint32_t& position, uint64_t value)
+{
+    stream += position;
+
+    // First eight bytes carry seven bits each, the ninth byte carries the
+    // remaining eight bits so it does not need a continuation flag
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        if (value < 128UL)
+        {
+            stream[i] = static_cast<uint8_t>(value);
+            position += i + 1;
+            return;
+        }
+
+        stream[i] = static_cast<uint8_t>(value | 128UL);
+        value >>= 7;
+    }
+
+    stream[8] = static_cast<uint8_t>(value);
+    position += 9;
+}
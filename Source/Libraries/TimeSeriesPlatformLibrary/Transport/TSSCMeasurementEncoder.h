@@ -0,0 +1,92 @@
+//******************************************************************************************************
+//  TSSCMeasurementEncoder.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - Grid Protection Alliance
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TSSC_MEASUREMENT_ENCODER_H
+#define __TSSC_MEASUREMENT_ENCODER_H
+
+#include "TSSCMeasurementParser.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Encoder for the time-series special compression (TSSC) format of the Gateway Exchange Protocol.
+    // Produces the stream consumed by the TSSCMeasurementParser.
+    class TSSCMeasurementEncoder
+    {
+    private:
+        uint8_t* m_data;
+        uint32_t m_position;
+        uint32_t m_lastPosition;
+
+        int64_t m_prevTimestamp1;
+        int64_t m_prevTimestamp2;
+
+        int64_t m_prevTimeDelta1;
+        int64_t m_prevTimeDelta2;
+        int64_t m_prevTimeDelta3;
+        int64_t m_prevTimeDelta4;
+
+        TSSCPointMetadataPtr m_lastPoint;
+        std::vector<TSSCPointMetadataPtr> m_points;
+
+        // The position in m_data where the bits in m_bitStreamCache will be flushed. -1 means no byte is reserved.
+        int32_t m_bitStreamBufferIndex;
+
+        // The number of bits in m_bitStreamCache that are valid. 0 Means the bitstream is empty.
+        int32_t m_bitStreamCount;
+
+        // A cache of bits that need to be flushed to m_data when full. Bits filled starting from the right moving left.
+        uint32_t m_bitStreamCache;
+
+        void WritePointIDChange(uint16_t id);
+        void WriteTimestampChange(int64_t timestamp);
+        void WriteQualityChange(uint32_t quality, const TSSCPointMetadataPtr& point);
+
+        void BitStreamFlush();
+        void BitStreamEnd();
+        void ClearBitStream();
+
+    public:
+        // Creates a new instance of the TSSC encoder.
+        TSSCMeasurementEncoder();
+
+        // Resets the TSSC Encoder to the initial state.
+        void Reset();
+
+        // Sets the internal buffer to write data to.
+        void SetBuffer(uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Adds a measurement to the stream. Returns false if there is not enough space left
+        // in the buffer, in which case the block should be finished and a new buffer set.
+        bool TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t quality, float32_t value);
+
+        // Flushes any pending bits and returns the position
+        // in the buffer where the encoded block ends.
+        uint32_t FinishBlock();
+
+        void WriteBits(int32_t code, int32_t length);
+    };
+}}}
+
+#endif
@@ -22,6 +22,7 @@
 //******************************************************************************************************
 
 #include "TSSCMeasurementParser.h"
+#include "TSSCMeasurementEncoder.h"
 #include "Constants.h"
 
 using namespace std;
@@ -32,16 +33,79 @@ using namespace GSF::TimeSeries::Transport;
 uint32_t Decode7BitUInt32(const uint8_t* stream, uint32_t& position);
 uint64_t Decode7BitUInt64(const uint8_t* stream, uint32_t& position);
 
+// Describes the code word that starts at the high bit of a peeked byte
+struct TSSCCodeWordEntry
+{
+    // Number of bits in the code word, including its prefix
+    uint8_t Length;
+
+    // One-based index of the prefix code, zero when the code follows the prefix bits
+    uint8_t Prefix;
+};
+
+// Code word lookup tables for each of the four adaptive modes, indexed by the
+// next 8 bits of the stream. Mode N gives single "1", "01" and "001" prefixes
+// to its N-1 most common codes and sends all other codes as N-1 zero bits
+// followed by the 5-bit code.
+static const struct TSSCCodeWordTable
+{
+    TSSCCodeWordEntry Entries[4][256];
+
+    TSSCCodeWordTable() : Entries{}
+    {
+        for (int32_t mode = 1; mode <= 4; mode++)
+        {
+            const int32_t prefixCount = mode - 1;
+
+            for (int32_t bits = 0; bits < 256; bits++)
+            {
+                int32_t leadingZeros = 0;
+
+                while (leadingZeros < prefixCount && (bits & (0x80 >> leadingZeros)) == 0)
+                    leadingZeros++;
+
+                TSSCCodeWordEntry& entry = Entries[mode - 1][bits];
+
+                if (leadingZeros < prefixCount)
+                {
+                    entry.Length = static_cast<uint8_t>(leadingZeros + 1);
+                    entry.Prefix = static_cast<uint8_t>(leadingZeros + 1);
+                }
+                else
+                {
+                    entry.Length = static_cast<uint8_t>(prefixCount + 5);
+                    entry.Prefix = 0;
+                }
+            }
+        }
+    }
+}
+CodeWordTable;
+
 TSSCPointMetadata::TSSCPointMetadata(TSSCMeasurementParser* parent) :
     m_parent(parent),
+    m_encoder(nullptr),
+    m_commandsSentSinceLastChange(0),
+    m_mode(4),
+    m_prefixCodes{TSSCCodeWords::Value1, TSSCCodeWords::Value2, TSSCCodeWords::Value3},
+    m_startupMode(0),
+    PrevNextPointId1(0),
+    PrevQuality1(0),
+    PrevQuality2(0),
+    PrevValue1(0),
+    PrevValue2(0),
+    PrevValue3(0)
+{
+    for (uint8_t i = 0; i < CommandStatsLength; i++)
+        m_commandStats[i] = 0;
+}
+
+TSSCPointMetadata::TSSCPointMetadata(TSSCMeasurementEncoder* encoder) :
+    m_parent(nullptr),
+    m_encoder(encoder),
     m_commandsSentSinceLastChange(0),
     m_mode(4),
-    m_mode21(0),
-    m_mode31(0),
-    m_mode301(0),
-    m_mode41(TSSCCodeWords::Value1),
-    m_mode401(TSSCCodeWords::Value2),
-    m_mode4001(TSSCCodeWords::Value3),
+    m_prefixCodes{TSSCCodeWords::Value1, TSSCCodeWords::Value2, TSSCCodeWords::Value3},
     m_startupMode(0),
     PrevNextPointId1(0),
     PrevQuality1(0),
@@ -56,61 +120,69 @@ TSSCPointMetadata::TSSCPointMetadata(TSSCMeasurementParser* parent) :
 
 int32_t TSSCPointMetadata::ReadCode()
 {
-    int32_t code;
+    if (m_mode < 1 || m_mode > 4)
+        throw SubscriberException("Unsupported compression mode");
+
+    const int32_t code = m_parent->ReadCodeWord(m_mode, m_prefixCodes);
 
+    UpdatedCodeStatistics(code);
+    return code;
+}
+
+void TSSCPointMetadata::WriteCode(int32_t code)
+{
     switch (m_mode)
     {
         case 1:
-            code = m_parent->ReadBits5();
+            m_encoder->WriteBits(code, 5);
             break;
         case 2:
-            if (m_parent->ReadBit() == 1)
+            if (code == m_prefixCodes[0])
             {
-                code = m_mode21;
+                m_encoder->WriteBits(1, 1);
             }
             else
             {
-                code = m_parent->ReadBits5();
+                m_encoder->WriteBits(code, 6);
             }
             break;
         case 3:
-            if (m_parent->ReadBit() == 1)
+            if (code == m_prefixCodes[0])
             {
-                code = m_mode31;
+                m_encoder->WriteBits(1, 1);
             }
-            else if (m_parent->ReadBit() == 1)
+            else if (code == m_prefixCodes[1])
             {
-                code = m_mode301;
+                m_encoder->WriteBits(1, 2);
             }
             else
             {
-                code = m_parent->ReadBits5();
+                m_encoder->WriteBits(code, 7);
             }
             break;
         case 4:
-            if (m_parent->ReadBit() == 1)
+            if (code == m_prefixCodes[0])
             {
-                code = m_mode41;
+                m_encoder->WriteBits(1, 1);
             }
-            else if (m_parent->ReadBit() == 1)
+            else if (code == m_prefixCodes[1])
             {
-                code = m_mode401;
+                m_encoder->WriteBits(1, 2);
             }
-            else if (m_parent->ReadBit() == 1)
+            else if (code == m_prefixCodes[2])
             {
-                code = m_mode4001;
+                m_encoder->WriteBits(1, 3);
             }
             else
             {
-                code = m_parent->ReadBits5();
+                m_encoder->WriteBits(code, 8);
             }
             break;
         default:
-            throw SubscriberException("Unsupported compression mode");
+            throw PublisherException("Unsupported compression mode");
     }
 
     UpdatedCodeStatistics(code);
-    return code;
 }
 
 void TSSCPointMetadata::UpdatedCodeStatistics(int32_t code)
@@ -202,20 +274,20 @@ void TSSCPointMetadata::AdaptCommands()
     else if (minSize == mode2Size)
     {
         m_mode = 2;
-        m_mode21 = code1;
+        m_prefixCodes[0] = code1;
     }
     else if (minSize == mode3Size)
     {
         m_mode = 3;
-        m_mode31 = code1;
-        m_mode301 = code2;
+        m_prefixCodes[0] = code1;
+        m_prefixCodes[1] = code2;
     }
     else if (minSize == mode4Size)
     {
         m_mode = 4;
-        m_mode41 = code1;
-        m_mode401 = code2;
-        m_mode4001 = code3;
+        m_prefixCodes[0] = code1;
+        m_prefixCodes[1] = code2;
+        m_prefixCodes[2] = code3;
     }
     else
     {
@@ -238,14 +310,16 @@ TSSCMeasurementParser::TSSCMeasurementParser() :
     m_bitStreamCount(0),
     m_bitStreamCache(0)
 {
-    m_lastPoint = NewSharedPtr<TSSCPointMetadata>(this);
+    m_startPoint = NewSharedPtr<TSSCPointMetadata>(this);
+    m_lastPoint = m_startPoint.get();
 }
 
 void TSSCMeasurementParser::Reset()
 {
     m_data = nullptr;
     m_points.clear();
-    m_lastPoint = NewSharedPtr<TSSCPointMetadata>(this);
+    m_startPoint = NewSharedPtr<TSSCPointMetadata>(this);
+    m_lastPoint = m_startPoint.get();
     m_position = 0;
     m_lastPosition = 0;
     ClearBitStream();
@@ -317,18 +391,19 @@ bool TSSCMeasurementParser::TryGetMeasurement(uint16_t& id, int64_t& timestamp,
         }
     }
 
-    id = m_lastPoint->PrevNextPointId1;    
-    TSSCPointMetadataPtr nextPoint = id >= m_points.size() ? nullptr : m_points[id];
+    id = m_lastPoint->PrevNextPointId1;
+
+    if (id >= m_points.size())
+        m_points.resize(id + 1, nullptr);
+
+    // Points are tracked by raw pointer while decoding to avoid
+    // reference count traffic for every measurement
+    TSSCPointMetadata* nextPoint = m_points[id].get();
     
     if (nextPoint == nullptr)
     {
-        nextPoint = NewSharedPtr<TSSCPointMetadata>(this);
-        
-        if (id >= m_points.size())
-            m_points.resize(id + 1, nullptr);
-
-        m_points[id] = nextPoint;
-        
+        m_points[id] = NewSharedPtr<TSSCPointMetadata>(this);
+        nextPoint = m_points[id].get();
         nextPoint->PrevNextPointId1 = static_cast<uint16_t>(id + 1);
     }
 
@@ -471,7 +546,7 @@ bool TSSCMeasurementParser::TryGetMeasurement(uint16_t& id, int64_t& timestamp,
     return true;
 }
 
-void TSSCMeasurementParser::DecodePointID(uint8_t code, const TSSCPointMetadataPtr& lastPoint)
+void TSSCMeasurementParser::DecodePointID(uint8_t code, TSSCPointMetadata* lastPoint)
 {
     if (code == TSSCCodeWords::PointIDXOR4)
     {
@@ -573,7 +648,7 @@ int64_t TSSCMeasurementParser::DecodeTimestamp(uint8_t code)
     return timestamp;
 }
 
-uint32_t TSSCMeasurementParser::DecodeQuality(uint8_t code, const TSSCPointMetadataPtr& nextPoint)
+uint32_t TSSCMeasurementParser::DecodeQuality(uint8_t code, TSSCPointMetadata* nextPoint)
 {
     uint32_t quality;
 
@@ -603,27 +678,63 @@ void TSSCMeasurementParser::ClearBitStream()
     m_bitStreamCache = 0;
 }
 
-int32_t TSSCMeasurementParser::ReadBit()
+// Returns the next 8 bits of the bit stream, most significant bit first, without
+// consuming them. Bits beyond the cached byte come from the byte at m_position,
+// which only becomes part of the bit stream once those bits are consumed.
+uint32_t TSSCMeasurementParser::PeekBits8() const
 {
-    if (m_bitStreamCount == 0)
+    const uint32_t next = m_position < m_lastPosition ? m_data[m_position] : 0U;
+    const uint32_t cached = m_bitStreamCache & ((1U << m_bitStreamCount) - 1U);
+
+    return ((cached << 8 | next) >> m_bitStreamCount) & 0xFFU;
+}
+
+// Consumes up to 8 bits from the bit stream.
+void TSSCMeasurementParser::ConsumeBits(int32_t count)
+{
+    if (count <= m_bitStreamCount)
+    {
+        m_bitStreamCount -= count;
+    }
+    else
     {
-        m_bitStreamCount = 8;
-        m_bitStreamCache = static_cast<int32_t>(m_data[m_position++]);
+        m_bitStreamCache = m_data[m_position++];
+        m_bitStreamCount += 8 - count;
     }
+}
 
-    m_bitStreamCount--;
-    
-    return (m_bitStreamCache >> m_bitStreamCount) & 1;
+int32_t TSSCMeasurementParser::ReadBit()
+{
+    const int32_t bit = static_cast<int32_t>(PeekBits8() >> 7);
+    ConsumeBits(1);
+    return bit;
 }
 
 int32_t TSSCMeasurementParser::ReadBits4()
 {
-    return ReadBit() << 3 | ReadBit() << 2 | ReadBit() << 1 | ReadBit();;
+    const int32_t bits = static_cast<int32_t>(PeekBits8() >> 4);
+    ConsumeBits(4);
+    return bits;
 }
 
 int32_t TSSCMeasurementParser::ReadBits5()
 {
-    return ReadBit() << 4 | ReadBit() << 3 | ReadBit() << 2 | ReadBit() << 1 | ReadBit();;
+    const int32_t bits = static_cast<int32_t>(PeekBits8() >> 3);
+    ConsumeBits(5);
+    return bits;
+}
+
+int32_t TSSCMeasurementParser::ReadCodeWord(uint8_t mode, const uint8_t* prefixCodes)
+{
+    // Any code word in any mode fits in the next 8 bits, so a single peek
+    // and table lookup replaces reading the prefix one bit at a time
+    const uint32_t bits = PeekBits8();
+    const TSSCCodeWordEntry entry = CodeWordTable.Entries[mode - 1][bits];
+
+    ConsumeBits(entry.Length);
+
+    // Codes without a prefix follow the zero bits as a 5-bit value
+    return entry.Prefix == 0 ? static_cast<int32_t>((bits >> (8 - entry.Length)) & 0x1FU) : prefixCodes[entry.Prefix - 1];
 }
 
 uint32_t Decode7BitUInt32(const uint8_t* stream, uint32_t& position)
@@ -31,29 +31,26 @@ namespace TimeSeries {
 namespace Transport
 {
     class TSSCMeasurementParser;
+    class TSSCMeasurementEncoder;
 
-    // The metadata kept for each pointID.
+    // The metadata kept for each pointID. Shared by the decoder and the encoder
+    // so that both sides adapt their code words in exactly the same way.
     class TSSCPointMetadata
     {
     private:
         static const uint8_t CommandStatsLength = 32;
 
         TSSCMeasurementParser* m_parent;
+        TSSCMeasurementEncoder* m_encoder;
         uint8_t m_commandStats[CommandStatsLength];
         int32_t m_commandsSentSinceLastChange;
 
         //Bit codes for the 4 modes of encoding. 
         uint8_t m_mode;
 
-        //(Mode 1 means no prefix.)
-        uint8_t m_mode21;
-
-        uint8_t m_mode31;
-        uint8_t m_mode301;
-
-        uint8_t m_mode41;
-        uint8_t m_mode401;
-        uint8_t m_mode4001;
+        //Codes assigned to the "1", "01" and "001" prefixes of the current mode,
+        //mode N uses the first N-1 entries. (Mode 1 means no prefix.)
+        uint8_t m_prefixCodes[3];
 
         int32_t m_startupMode;
 
@@ -62,6 +59,7 @@ namespace Transport
 
     public:
         TSSCPointMetadata(TSSCMeasurementParser* parent);
+        TSSCPointMetadata(TSSCMeasurementEncoder* encoder);
 
         uint16_t PrevNextPointId1;
 
@@ -72,6 +70,7 @@ namespace Transport
         uint32_t PrevValue3;
 
         int32_t ReadCode();
+        void WriteCode(int32_t code);
     };
 
     typedef SharedPtr<TSSCPointMetadata> TSSCPointMetadataPtr;
@@ -92,22 +91,27 @@ namespace Transport
         int64_t m_prevTimeDelta3;
         int64_t m_prevTimeDelta4;
 
-        TSSCPointMetadataPtr m_lastPoint;
+        // Metadata used to read the first code word, before any point has been decoded
+        TSSCPointMetadataPtr m_startPoint;
+        TSSCPointMetadata* m_lastPoint;
         std::vector<TSSCPointMetadataPtr> m_points;
 
         // The number of bits in m_bitStreamCache that are valid. 0 Means the bitstream is empty.
         int32_t m_bitStreamCount;
 
-        // A cache of bits that need to be flushed to m_buffer when full. Bits filled starting from the right moving left.
-        int32_t m_bitStreamCache;
+        // The most recently loaded bit stream byte, the low m_bitStreamCount bits have not been read yet.
+        uint32_t m_bitStreamCache;
 
-        void DecodePointID(uint8_t code, const TSSCPointMetadataPtr& lastPoint);
+        void DecodePointID(uint8_t code, TSSCPointMetadata* lastPoint);
         int64_t DecodeTimestamp(uint8_t code);
-        uint32_t DecodeQuality(uint8_t code, const TSSCPointMetadataPtr& nextPoint);
+        uint32_t DecodeQuality(uint8_t code, TSSCPointMetadata* nextPoint);
 
         bool BitStreamIsEmpty() const;
         void ClearBitStream();
 
+        uint32_t PeekBits8() const;
+        void ConsumeBits(int32_t count);
+
     public:
         // Creates a new instance of the compact measurement parser.
         TSSCMeasurementParser();
@@ -124,6 +128,9 @@ namespace Transport
         int32_t ReadBit();
         int32_t ReadBits4();
         int32_t ReadBits5();
+
+        // Reads the next code word using the lookup table for the given mode.
+        int32_t ReadCodeWord(uint8_t mode, const uint8_t* prefixCodes);
     };
 }}}
 
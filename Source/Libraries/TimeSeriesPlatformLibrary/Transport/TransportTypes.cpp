@@ -48,6 +48,33 @@ const char* PublisherException::what() const noexcept
     return &m_message[0];
 }
 
+MeasurementSource::MeasurementSource()
+{
+}
+
+MeasurementSource::MeasurementSource(const string& value) :
+    m_value(NewSharedPtr<const string>(value))
+{
+}
+
+const string& MeasurementSource::ToString() const
+{
+    if (m_value == nullptr)
+        return Empty::String;
+
+    return *m_value;
+}
+
+MeasurementSource::operator const string&() const
+{
+    return ToString();
+}
+
+ostream& GSF::TimeSeries::operator << (ostream& stream, const MeasurementSource& source)
+{
+    return stream << source.ToString();
+}
+
 Measurement::Measurement() :
     ID(0),
     SignalID(Empty::Guid),
@@ -52,6 +52,30 @@ namespace TimeSeries
         const char* what() const noexcept;
     };
 
+    // Source used in human-readable measurement key. Copies share a single
+    // immutable string, so received measurements referring to the same source
+    // do not each carry their own copy. A source always owns its value, it is
+    // only ever constructed explicitly from a string which it copies.
+    class MeasurementSource
+    {
+    private:
+        SharedPtr<const std::string> m_value;
+
+    public:
+        // Creates a new empty source.
+        MeasurementSource();
+
+        // Creates a new source from a copy of the given value.
+        explicit MeasurementSource(const std::string& value);
+
+        // Gets the source value.
+        const std::string& ToString() const;
+
+        operator const std::string&() const;
+    };
+
+    std::ostream& operator << (std::ostream& stream, const MeasurementSource& source);
+
     // Fundamental data type used by the Time Series Framework
     struct Measurement
     {
@@ -61,7 +85,7 @@ namespace TimeSeries
 
         // Source used in human-
         // readable measurement key.
-        std::string Source;
+        MeasurementSource Source;
 
         // Measurement's globally
         // unique identifier.
@@ -105,6 +129,34 @@ namespace TimeSeries
 
     typedef SharedPtr<Measurement> MeasurementPtr;
 
+    // Plain value representation of a received measurement. Used by the
+    // DataSubscriber to deliver measurements from a reused buffer without
+    // any per-measurement heap allocation. Human-readable measurement key
+    // (i.e., Source and ID) can be looked up from the signal index cache
+    // using the runtime ID when needed.
+    struct MeasurementValue
+    {
+        // 16-bit runtime ID assigned by
+        // the publisher's signal index cache.
+        uint16_t RuntimeID;
+
+        // Measurement's globally
+        // unique identifier.
+        Guid SignalID;
+
+        // The time, in ticks, that
+        // this measurement was taken.
+        int64_t Timestamp;
+
+        // Flags indicating the state of the measurement
+        // as reported by the device that took it.
+        uint32_t Flags;
+
+        // Instantaneous value
+        // of the measurement.
+        float64_t Value;
+    };
+
     enum SignalKind : int16_t
     {
         Angle,			// Phase angle